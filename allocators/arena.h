@@ -0,0 +1,150 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/*
+  arena.h
+  - MonotonicArena: bump-pointer region allocator
+      • allocate() only moves a pointer forward; deallocate is a no-op
+      • memory comes in geometrically growing blocks (optionally starting from a
+        caller-supplied buffer, e.g. on the stack)
+      • release() frees every block at once: O(#blocks), independent of how many
+        objects were carved from it
+  - ArenaAllocator<T>: STL-compatible allocator handle pointing at a MonotonicArena,
+    usable with the containers in this repo and with std:: containers.
+  - Not thread-safe: use one arena per thread / per request.
+  - Containers using an arena must be destroyed (or never touched again) before
+    release(); element destructors are still run by the container, only the
+    per-node frees are skipped.
+  - Methods:
+      MonotonicArena(size_t first_block = 4096)
+      MonotonicArena(void* buffer, size_t size)      // use buffer first, then the heap
+      void* allocate(size_t bytes, size_t align = alignof(std::max_align_t))
+      void release()                                  // free all blocks, rewind
+      size_t bytes_used() const / size_t bytes_reserved() const / size_t block_count() const
+*/
+
+class MonotonicArena {
+private:
+    struct Block {
+        Block *prev;
+        std::size_t size;   // usable bytes after the header
+    };
+
+    static constexpr std::size_t HEADER = (sizeof(Block) + alignof(std::max_align_t) - 1)
+                                          & ~(alignof(std::max_align_t) - 1);
+
+    Block *blocks_;          // most recent heap block (singly linked through prev)
+    unsigned char *cur_;     // next free byte
+    unsigned char *end_;     // end of the current region
+    unsigned char *initial_; // caller-supplied buffer (never freed)
+    std::size_t initial_size_;
+    std::size_t next_size_;  // size of the next heap block
+    std::size_t used_;
+    std::size_t reserved_;
+    std::size_t block_count_;
+
+    static std::uintptr_t align_up(std::uintptr_t p, std::size_t align) {
+        return (p + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+    }
+
+    void add_block(std::size_t min_bytes) {
+        std::size_t size = next_size_;
+        while (size < min_bytes) size *= 2;
+        Block *b = static_cast<Block*>(::operator new(HEADER + size));
+        b->prev = blocks_;
+        b->size = size;
+        blocks_ = b;
+        cur_ = reinterpret_cast<unsigned char*>(b) + HEADER;
+        end_ = cur_ + size;
+        next_size_ = size * 2;
+        reserved_ += size;
+        ++block_count_;
+    }
+
+public:
+    explicit MonotonicArena(std::size_t first_block = 4096)
+        : blocks_(nullptr), cur_(nullptr), end_(nullptr), initial_(nullptr), initial_size_(0),
+          next_size_(first_block ? first_block : 64), used_(0), reserved_(0), block_count_(0) {}
+
+    MonotonicArena(void *buffer, std::size_t size)
+        : blocks_(nullptr), cur_(static_cast<unsigned char*>(buffer)),
+          end_(static_cast<unsigned char*>(buffer) + size),
+          initial_(static_cast<unsigned char*>(buffer)), initial_size_(size),
+          next_size_(size ? size * 2 : 4096), used_(0), reserved_(size), block_count_(0) {}
+
+    ~MonotonicArena() { release(); }
+
+    // non-copyable (owns blocks)
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    // align must be a power of two
+    void* allocate(std::size_t bytes, std::size_t align = alignof(std::max_align_t)) {
+        if (bytes == 0) bytes = 1;
+        std::uintptr_t p = align_up(reinterpret_cast<std::uintptr_t>(cur_), align);
+        if (!cur_ || p + bytes > reinterpret_cast<std::uintptr_t>(end_)) {
+            add_block(bytes + align);
+            p = align_up(reinterpret_cast<std::uintptr_t>(cur_), align);
+        }
+        cur_ = reinterpret_cast<unsigned char*>(p + bytes);
+        used_ += bytes;
+        return reinterpret_cast<void*>(p);
+    }
+
+    // Individual frees are ignored; memory comes back with release().
+    void deallocate(void*, std::size_t) {}
+
+    // Free every heap block and rewind to the initial buffer (if any).
+    void release() {
+        while (blocks_) {
+            Block *prev = blocks_->prev;
+            ::operator delete(blocks_);
+            blocks_ = prev;
+        }
+        cur_ = initial_;
+        end_ = initial_ ? initial_ + initial_size_ : nullptr;
+        used_ = 0;
+        reserved_ = initial_size_;
+        block_count_ = 0;
+    }
+
+    std::size_t bytes_used() const { return used_; }
+    std::size_t bytes_reserved() const { return reserved_; }
+    std::size_t block_count() const { return block_count_; }
+};
+
+template<typename T>
+class ArenaAllocator {
+private:
+    MonotonicArena *arena_;
+
+    template<typename U> friend class ArenaAllocator;
+
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena &arena) noexcept : arena_(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept : arena_(other.arena_) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, std::size_t) noexcept {}
+
+    MonotonicArena* arena() const noexcept { return arena_; }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U> &o) const noexcept { return arena_ == o.arena_; }
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U> &o) const noexcept { return arena_ != o.arena_; }
+};
+
+#endif // ARENA_H
@@ -0,0 +1,78 @@
+#ifndef MALLOC_ALLOCATOR_H
+#define MALLOC_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+  malloc_allocator.h
+  - MallocAllocator<T>: stateless STL-compatible allocator on std::malloc / std::free
+  - Adds reallocate(p, old_n, new_n), which containers may use to grow a buffer of
+    trivially copyable elements with std::realloc (often extending the block in place).
+    DynamicArray uses it by default.
+  - Over-aligned T (alignof > alignof(max_align_t)) is served by aligned operator new,
+    and reallocate falls back to allocate + memcpy for it.
+  - has_reallocate<Alloc>::value detects the extension on any allocator.
+*/
+
+template<typename T>
+class MallocAllocator {
+public:
+    using value_type = T;
+
+    MallocAllocator() noexcept = default;
+    template<typename U>
+    MallocAllocator(const MallocAllocator<U>&) noexcept {}
+
+    // malloc only guarantees alignof(max_align_t); over-aligned T goes through aligned new
+    static constexpr bool over_aligned = alignof(T) > alignof(std::max_align_t);
+
+    T* allocate(std::size_t n) {
+        if constexpr (over_aligned) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        } else {
+            void *p = std::malloc(n * sizeof(T));
+            if (!p && n) throw std::bad_alloc();
+            return static_cast<T*>(p);
+        }
+    }
+
+    void deallocate(T *p, std::size_t) noexcept {
+        if constexpr (over_aligned) ::operator delete(p, std::align_val_t(alignof(T)));
+        else std::free(p);
+    }
+
+    // Only valid for trivially copyable T (elements are moved bytewise). Over-aligned T
+    // cannot use realloc (it may return a less aligned block): allocate + copy instead.
+    T* reallocate(T *p, std::size_t old_n, std::size_t new_n) {
+        static_assert(std::is_trivially_copyable<T>::value, "MallocAllocator::reallocate: T must be trivially copyable");
+        if constexpr (over_aligned) {
+            T *np = new_n ? allocate(new_n) : nullptr;
+            if (p && np) std::memcpy(static_cast<void*>(np), static_cast<const void*>(p), (old_n < new_n ? old_n : new_n) * sizeof(T));
+            deallocate(p, old_n);
+            return np;
+        } else {
+            void *np = std::realloc(p, new_n * sizeof(T));
+            if (!np && new_n) throw std::bad_alloc();
+            return static_cast<T*>(np);
+        }
+    }
+
+    template<typename U>
+    bool operator==(const MallocAllocator<U>&) const noexcept { return true; }
+    template<typename U>
+    bool operator!=(const MallocAllocator<U>&) const noexcept { return false; }
+};
+
+template<typename Alloc, typename = void>
+struct has_reallocate : std::false_type {};
+
+template<typename Alloc>
+struct has_reallocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+    std::declval<typename Alloc::value_type*>(), std::size_t{}, std::size_t{}))>> : std::true_type {};
+
+#endif // MALLOC_ALLOCATOR_H
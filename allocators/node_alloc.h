@@ -0,0 +1,42 @@
+#ifndef NODE_ALLOC_H
+#define NODE_ALLOC_H
+
+#include <memory>
+#include <utility>
+
+/*
+  node_alloc.h
+  - Single-node allocate + construct / destroy + deallocate through any allocator, shared
+    by the node containers (linked lists, LinkedQueue, LinkedStack). Pass the allocator
+    already rebound to the node type.
+  - Functions (namespace nodealloc):
+      pointer create_node(Alloc& a, Args&&... args)   // the block is handed back to a if
+                                                      // the node's constructor throws
+      void destroy_node(Alloc& a, pointer n)
+*/
+
+namespace nodealloc {
+
+    template<typename Alloc, typename... Args>
+    typename std::allocator_traits<Alloc>::pointer create_node(Alloc &a, Args&&... args) {
+        using Traits = std::allocator_traits<Alloc>;
+        typename Traits::pointer n = Traits::allocate(a, 1);
+        try {
+            Traits::construct(a, n, std::forward<Args>(args)...);
+        } catch (...) {
+            Traits::deallocate(a, n, 1);
+            throw;
+        }
+        return n;
+    }
+
+    template<typename Alloc>
+    void destroy_node(Alloc &a, typename std::allocator_traits<Alloc>::pointer n) {
+        using Traits = std::allocator_traits<Alloc>;
+        Traits::destroy(a, n);
+        Traits::deallocate(a, n, 1);
+    }
+
+} // namespace nodealloc
+
+#endif // NODE_ALLOC_H
@@ -0,0 +1,150 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+
+/*
+  node_pool.h
+  - NodePool: fixed-size block pool for linked-structure nodes
+      • requests are rounded up to one of CLASSES size classes (GRANULE bytes apart,
+        up to MAX_BLOCK); each class keeps an intrusive free list of blocks
+      • blocks are carved from large chunks, so a push/pop loop on a linked container
+        recycles the same few blocks instead of calling malloc/free per node
+      • release() hands every chunk back at once
+  - PoolAllocator<T>: STL-compatible allocator handle pointing at a NodePool.
+    Single-object allocations (the node case) that fit a size class come from the pool;
+    arrays and oversized / over-aligned types fall through to ::operator new.
+  - Not thread-safe: use one pool per thread.
+  - Methods:
+      NodePool(size_t chunk_bytes = 64 KiB)
+      void* allocate(size_t bytes)           // bytes > MAX_BLOCK falls back to ::operator new
+      void deallocate(void* p, size_t bytes)  // same bytes as allocate (picks pool or heap)
+      void release()                         // free all chunks (outstanding blocks become invalid)
+      size_t chunk_count() const / size_t bytes_reserved() const
+*/
+
+class NodePool {
+public:
+    static constexpr std::size_t GRANULE = alignof(std::max_align_t);
+    static constexpr std::size_t CLASSES = 16;
+    static constexpr std::size_t MAX_BLOCK = GRANULE * CLASSES;
+
+private:
+    struct FreeBlock { FreeBlock *next; };
+    struct Chunk { Chunk *prev; };
+
+    static constexpr std::size_t HEADER = (sizeof(Chunk) + GRANULE - 1) & ~(GRANULE - 1);
+
+    FreeBlock *free_[CLASSES];
+    Chunk *chunks_;
+    unsigned char *cur_;   // carve position in the newest chunk
+    unsigned char *end_;
+    std::size_t chunk_bytes_;
+    std::size_t chunk_count_;
+
+    static std::size_t class_of(std::size_t bytes) {
+        return bytes ? (bytes - 1) / GRANULE : 0;
+    }
+
+    void add_chunk() {
+        Chunk *c = static_cast<Chunk*>(::operator new(HEADER + chunk_bytes_));
+        c->prev = chunks_;
+        chunks_ = c;
+        cur_ = reinterpret_cast<unsigned char*>(c) + HEADER;
+        end_ = cur_ + chunk_bytes_;
+        ++chunk_count_;
+    }
+
+public:
+    explicit NodePool(std::size_t chunk_bytes = 64 * 1024)
+        : chunks_(nullptr), cur_(nullptr), end_(nullptr),
+          chunk_bytes_(chunk_bytes < MAX_BLOCK ? MAX_BLOCK : (chunk_bytes + GRANULE - 1) & ~(GRANULE - 1)),
+          chunk_count_(0) {
+        for (auto &f : free_) f = nullptr;
+    }
+
+    ~NodePool() { release(); }
+
+    // non-copyable (owns chunks)
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    void* allocate(std::size_t bytes) {
+        if (bytes > MAX_BLOCK) return ::operator new(bytes);   // no size class: plain heap block
+        std::size_t c = class_of(bytes);
+        if (FreeBlock *b = free_[c]) {
+            free_[c] = b->next;
+            return b;
+        }
+        std::size_t size = (c + 1) * GRANULE;
+        if (static_cast<std::size_t>(end_ - cur_) < size) add_chunk(); // tail of old chunk is dropped
+        void *p = cur_;
+        cur_ += size;
+        return p;
+    }
+
+    void deallocate(void *p, std::size_t bytes) {
+        if (!p) return;
+        if (bytes > MAX_BLOCK) {
+            ::operator delete(p);
+            return;
+        }
+        FreeBlock *b = static_cast<FreeBlock*>(p);
+        std::size_t c = class_of(bytes);
+        b->next = free_[c];
+        free_[c] = b;
+    }
+
+    void release() {
+        while (chunks_) {
+            Chunk *prev = chunks_->prev;
+            ::operator delete(chunks_);
+            chunks_ = prev;
+        }
+        for (auto &f : free_) f = nullptr;
+        cur_ = end_ = nullptr;
+        chunk_count_ = 0;
+    }
+
+    std::size_t chunk_count() const { return chunk_count_; }
+    std::size_t bytes_reserved() const { return chunk_count_ * chunk_bytes_; }
+};
+
+template<typename T>
+class PoolAllocator {
+private:
+    NodePool *pool_;
+
+    template<typename U> friend class PoolAllocator;
+
+    static constexpr bool pooled_type = sizeof(T) <= NodePool::MAX_BLOCK &&
+                                        alignof(T) <= NodePool::GRANULE;
+
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(NodePool &pool) noexcept : pool_(&pool) {}
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U> &other) noexcept : pool_(other.pool_) {}
+
+    T* allocate(std::size_t n) {
+        if (pooled_type && n == 1) return static_cast<T*>(pool_->allocate(sizeof(T)));
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+    }
+
+    void deallocate(T *p, std::size_t n) noexcept {
+        if (pooled_type && n == 1) pool_->deallocate(p, sizeof(T));
+        else ::operator delete(p, std::align_val_t(alignof(T)));
+    }
+
+    NodePool* pool() const noexcept { return pool_; }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U> &o) const noexcept { return pool_ == o.pool_; }
+    template<typename U>
+    bool operator!=(const PoolAllocator<U> &o) const noexcept { return pool_ != o.pool_; }
+};
+
+#endif // NODE_POOL_H
@@ -2,89 +2,232 @@
 #define DYNAMIC_ARRAY_H
 
 #include <cstddef>
+#include <cstring>
+#include <new>
 #include <vector>
 #include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <memory>
+#include "../allocators/malloc_allocator.h"
 
-// A simple vector-like dynamic array with manual memory management
-template<typename T>
+// A simple vector-like dynamic array with manual memory management.
+// Storage is raw (uninitialized) memory from Alloc: only the first len slots hold
+// constructed elements. Growth relocates elements with move_if_noexcept; trivially
+// copyable types are relocated with Alloc::reallocate when the allocator has one
+// (the default MallocAllocator uses realloc, which can often extend the block in place).
+// Over-aligned T always grows by allocate + copy, so alignof(T) is honoured as long as
+// Alloc::allocate honours it (MallocAllocator does).
+template<typename T, typename Alloc = MallocAllocator<T>>
 class DynamicArray {
 private:
-    T *buf;       // underlying buffer
+    using Traits = std::allocator_traits<Alloc>;
+
+    T *buf;       // underlying buffer (raw storage for cap elements)
     size_t cap;   // current capacity
     size_t len;   // current size
+    Alloc alloc;
+
+    static constexpr bool trivial = std::is_trivially_copyable<T>::value;
+    // realloc-style growth only for fundamental alignment: a reallocate() built on realloc
+    // returns max_align_t-aligned blocks, too weak for over-aligned T
+    static constexpr bool use_reallocate = trivial && has_reallocate<Alloc>::value &&
+                                           alignof(T) <= alignof(std::max_align_t);
+
+    T* allocate(size_t n) {
+        return n ? Traits::allocate(alloc, n) : nullptr;
+    }
+
+    void deallocate(T *p, size_t n) {
+        if (p) Traits::deallocate(alloc, p, n);
+    }
+
+    void destroy_range(T *first, T *last) {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+            for (; first != last; ++first) Traits::destroy(alloc, first);
+    }
+
+    // Move (or copy, if moving could throw) the live elements into a buffer of newCap.
+    void reallocate(size_t newCap) {
+        if constexpr (use_reallocate) {
+            buf = alloc.reallocate(buf, cap, newCap);
+        } else {
+            T *nb = allocate(newCap);
+            if constexpr (trivial) {
+                if (len) std::memcpy(static_cast<void*>(nb), static_cast<const void*>(buf), len * sizeof(T));
+            } else {
+                size_t i = 0;
+                try {
+                    for (; i < len; ++i) Traits::construct(alloc, nb + i, std::move_if_noexcept(buf[i]));
+                } catch (...) {
+                    destroy_range(nb, nb + i);
+                    deallocate(nb, newCap);
+                    throw;
+                }
+                destroy_range(buf, buf + len);
+            }
+            deallocate(buf, cap);
+            buf = nb;
+        }
+        cap = newCap;
+    }
 
     // Grow capacity (at least min_needed)
     void grow(size_t min_needed = 0) {
         size_t newCap = std::max(cap ? cap * 2 : (size_t)1, std::max((size_t)1, min_needed));
-        T *nb = new T[newCap];
-        for (size_t i = 0; i < len; ++i) nb[i] = buf[i];
-        delete[] buf;
-        buf = nb;
-        cap = newCap;
+        reallocate(newCap);
+    }
+
+    void release() {
+        destroy_range(buf, buf + len);
+        deallocate(buf, cap);
+        buf = nullptr;
+        cap = len = 0;
     }
 
 public:
     // Constructors & Destructor
-    DynamicArray(): buf(nullptr), cap(0), len(0) {}
+    DynamicArray(): buf(nullptr), cap(0), len(0), alloc() {}
 
-    DynamicArray(size_t initial_cap): buf(nullptr), cap(0), len(0) {
-        if (initial_cap) {
-            buf = new T[initial_cap];
-            cap = initial_cap;
-        }
+    explicit DynamicArray(const Alloc &a): buf(nullptr), cap(0), len(0), alloc(a) {}
+
+    DynamicArray(size_t initial_cap, const Alloc &a = Alloc()): buf(nullptr), cap(0), len(0), alloc(a) {
+        reserve(initial_cap);
     }
 
-    DynamicArray(const std::vector<T> &v) {
-        len = v.size();
-        cap = len ? len : 1;
-        buf = new T[cap];
-        for (size_t i = 0; i < len; ++i) buf[i] = v[i];
+    DynamicArray(const std::vector<T> &v, const Alloc &a = Alloc()): buf(nullptr), cap(0), len(0), alloc(a) {
+        reserve(v.size() ? v.size() : 1);
+        for (const T &x : v) push_back(x);
     }
 
-    ~DynamicArray() { delete[] buf; }
+    ~DynamicArray() { release(); }
+
+    // Non-copyable (a shallow copy would double-free the buffer); moveable
+    DynamicArray(const DynamicArray &) = delete;
+    DynamicArray& operator=(const DynamicArray &) = delete;
+
+    DynamicArray(DynamicArray &&other) noexcept
+        : buf(other.buf), cap(other.cap), len(other.len), alloc(std::move(other.alloc)) {
+        other.buf = nullptr; other.cap = 0; other.len = 0;
+    }
+    // the allocator travels with the buffer
+    DynamicArray& operator=(DynamicArray &&other) noexcept {
+        if (this != &other) {
+            release();
+            alloc = std::move(other.alloc);
+            buf = other.buf; cap = other.cap; len = other.len;
+            other.buf = nullptr; other.cap = 0; other.len = 0;
+        }
+        return *this;
+    }
 
     // Capacity & Size
     size_t size() const { return len; }
     size_t capacity() const { return cap; }
+    bool empty() const { return len == 0; }
+
+    // Make room for at least n elements without changing size
+    void reserve(size_t n) {
+        if (n > cap) reallocate(n);
+    }
+
+    // Release unused capacity
+    void shrink_to_fit() {
+        if (len == cap) return;
+        if (len == 0) { release(); return; }
+        reallocate(len);
+    }
 
     // Add element at end
     void push_back(const T &v) {
-        if (len >= cap) grow(std::max((size_t)2, cap * 2));
-        buf[len++] = v;
+        if (len >= cap) {
+            // v may live inside buf: copy it before the buffer moves
+            T tmp(v);
+            grow(std::max((size_t)2, cap * 2));
+            Traits::construct(alloc, buf + len, std::move(tmp));
+        } else {
+            Traits::construct(alloc, buf + len, v);
+        }
+        ++len;
+    }
+
+    void push_back(T &&v) { emplace_back(std::move(v)); }
+
+    // Construct an element in place at the end; returns a reference to it
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (len >= cap) {
+            T tmp(std::forward<Args>(args)...);
+            grow(std::max((size_t)2, cap * 2));
+            Traits::construct(alloc, buf + len, std::move(tmp));
+        } else {
+            Traits::construct(alloc, buf + len, std::forward<Args>(args)...);
+        }
+        return buf[len++];
+    }
+
+    // Remove last element
+    bool pop_back() {
+        if (len == 0) return false;
+        --len;
+        Traits::destroy(alloc, buf + len);
+        return true;
     }
 
     // Insert at position
-    bool insert(size_t pos, const T &v) {
+    bool insert(size_t pos, const T &v) { return emplace(pos, v); }
+    bool insert(size_t pos, T &&v) { return emplace(pos, std::move(v)); }
+
+    // Construct an element at position (shifts the tail right)
+    template<typename... Args>
+    bool emplace(size_t pos, Args&&... args) {
         if (pos > len) return false;
+        if (pos == len) { emplace_back(std::forward<Args>(args)...); return true; }
+        T tmp(std::forward<Args>(args)...);
         if (len >= cap) grow(std::max((size_t)2, cap * 2));
-        for (size_t i = len; i > pos; --i) buf[i] = buf[i - 1];
-        buf[pos] = v;
-        ++len;
+        if constexpr (trivial) {
+            std::memmove(static_cast<void*>(buf + pos + 1), static_cast<const void*>(buf + pos), (len - pos) * sizeof(T));
+            Traits::construct(alloc, buf + pos, std::move(tmp));
+            ++len;
+        } else {
+            // last element moves into the raw slot and is counted at once, so a throwing
+            // shift below leaves it owned (and later destroyed) by the array
+            Traits::construct(alloc, buf + len, std::move(buf[len - 1]));
+            ++len;
+            for (size_t i = len - 2; i > pos; --i) buf[i] = std::move(buf[i - 1]);
+            buf[pos] = std::move(tmp);
+        }
         return true;
     }
 
     // Erase at position
     bool erase(size_t pos) {
         if (pos >= len) return false;
-        for (size_t i = pos; i + 1 < len; ++i) buf[i] = buf[i + 1];
+        if constexpr (trivial) {
+            std::memmove(static_cast<void*>(buf + pos), static_cast<const void*>(buf + pos + 1), (len - pos - 1) * sizeof(T));
+        } else {
+            for (size_t i = pos; i + 1 < len; ++i) buf[i] = std::move(buf[i + 1]);
+            Traits::destroy(alloc, buf + len - 1);
+        }
         --len;
         return true;
     }
 
-    // Resize array
+    // Remove all elements (capacity is kept)
+    void clear() {
+        destroy_range(buf, buf + len);
+        len = 0;
+    }
+
+    // Resize array (new elements are value-initialized)
     void resize(size_t newSize) {
-        if (newSize <= cap) {
-            if (newSize < len) len = newSize;
-            else {
-                for (size_t i = len; i < newSize; ++i) buf[i] = T();
-                len = newSize;
-            }
+        if (newSize < len) {
+            destroy_range(buf + newSize, buf + len);
+            len = newSize;
             return;
         }
-        // expand
-        grow(newSize);
-        for (size_t i = len; i < newSize; ++i) buf[i] = T();
-        len = newSize;
+        if (newSize > cap) grow(newSize);
+        for (; len < newSize; ++len) Traits::construct(alloc, buf + len);
     }
 
     // Find element (linear search)
@@ -96,6 +239,11 @@ public:
     // Access
     T& operator[](size_t i) { return buf[i]; }
     const T& operator[](size_t i) const { return buf[i]; }
+
+    T* data() { return buf; }
+    const T* data() const { return buf; }
+
+    Alloc get_allocator() const { return alloc; }
 };
 
 #endif // DYNAMIC_ARRAY_H
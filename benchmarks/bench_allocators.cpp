@@ -0,0 +1,97 @@
+// std::allocator vs PoolAllocator (NodePool) vs ArenaAllocator (MonotonicArena) behind the
+// node containers:
+//   churn     a LinkedQueue held at `window` elements, one enqueue + one dequeue per op
+//             (the arena is left out: it never reuses freed nodes)
+//   build     a DoublyLinkedList of n elements built and destroyed `rounds` times
+//             (the arena is released after each round)
+//   raw       NodePool::allocate/deallocate vs ::operator new/delete, 32-byte blocks freed
+//             in a scrambled order
+//
+//   g++ -std=c++17 -O2 bench_allocators.cpp -o bench_allocators
+//   ./bench_allocators [ops=20000000] [window=1024] [n=1000000] [rounds=10]
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <new>
+#include <vector>
+#include "bench_util.h"
+#include "../allocators/arena.h"
+#include "../allocators/node_pool.h"
+#include "../queue/linked_queue.h"
+#include "../linked_list/doubly_linked_list.h"
+
+using T = std::uint64_t;
+
+template<typename Alloc>
+double churn(std::size_t ops, std::size_t window, const Alloc &a) {
+    LinkedQueue<T, Alloc> q(a);
+    for (std::size_t i = 0; i < window; ++i) q.enqueue(i);
+    bench::Timer t;
+    for (std::size_t i = 0; i < ops; ++i) {
+        q.enqueue(i);
+        q.dequeue();
+    }
+    double s = t.seconds();
+    bench::do_not_optimize(q.size());
+    return s;
+}
+
+template<typename Alloc, typename AfterRound>
+double build(std::size_t n, std::size_t rounds, const Alloc &a, AfterRound after_round) {
+    double total = 0;
+    for (std::size_t r = 0; r < rounds; ++r) {
+        bench::Timer t;
+        {
+            DoublyLinkedList<T, Alloc> list(a);
+            for (std::size_t i = 0; i < n; ++i) list.push_back(i);
+            bench::do_not_optimize(list.size());
+        }
+        after_round();
+        total += t.seconds();
+    }
+    return total;
+}
+
+// Allocate `live` blocks, then repeatedly free one at a random slot and allocate a new one
+template<typename Allocate, typename Free>
+double raw(std::size_t ops, std::size_t live, Allocate allocate, Free free_block) {
+    std::vector<void*> slots(live);
+    for (auto &p : slots) p = allocate();
+    bench::Rng rng(7);
+    bench::Timer t;
+    for (std::size_t i = 0; i < ops; ++i) {
+        std::size_t j = rng.below(live);
+        free_block(slots[j]);
+        slots[j] = allocate();
+    }
+    double s = t.seconds();
+    for (void *p : slots) free_block(p);
+    return s;
+}
+
+int main(int argc, char **argv) {
+    std::size_t ops = bench::arg_or(argc, argv, 1, 20000000);
+    std::size_t window = bench::arg_or(argc, argv, 2, 1024);
+    std::size_t n = bench::arg_or(argc, argv, 3, 1000000);
+    std::size_t rounds = bench::arg_or(argc, argv, 4, 10);
+    std::printf("ops=%zu window=%zu n=%zu rounds=%zu\n", ops, window, n, rounds);
+
+    NodePool pool;
+    MonotonicArena arena;
+    auto nothing = [] {};
+
+    bench::report("churn LinkedQueue   std::allocator", ops, churn(ops, window, std::allocator<T>()));
+    bench::report("churn LinkedQueue   PoolAllocator", ops, churn(ops, window, PoolAllocator<T>(pool)));
+
+    bench::report("build DoublyLinked  std::allocator", n * rounds, build(n, rounds, std::allocator<T>(), nothing));
+    bench::report("build DoublyLinked  PoolAllocator", n * rounds, build(n, rounds, PoolAllocator<T>(pool), nothing));
+    bench::report("build DoublyLinked  ArenaAllocator", n * rounds,
+                  build(n, rounds, ArenaAllocator<T>(arena), [&] { arena.release(); }));
+
+    const std::size_t block = 32;
+    bench::report("raw 32B             operator new", ops,
+                  raw(ops, window, [] { return ::operator new(block); }, [](void *p) { ::operator delete(p); }));
+    bench::report("raw 32B             NodePool", ops,
+                  raw(ops, window, [&] { return pool.allocate(block); }, [&](void *p) { pool.deallocate(p, block); }));
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Micro-benchmarks for the ring-buffer containers in queue/:
+//   Deque / SegmentedDeque / std::deque
+//     grow       push_back n elements from empty, then pop_front them all
+//     fifo       push_back + pop_front at a steady `window` elements
+//     both ends  push_front and push_back alternately, then pop from both ends
+//     index      sum of d[i] over every i (random access)
+//   ArrayQueue / std::queue (on std::deque)
+//     fifo       enqueue + dequeue at a steady `window` elements
+//     burst      fill to capacity, drain, repeat
+//
+//   g++ -std=c++17 -O2 bench_deque.cpp -o bench_deque
+//   ./bench_deque [n=10000000] [window=1024]
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <queue>
+#include "bench_util.h"
+#include "../queue/array_queue.h"
+#include "../queue/deque.h"
+#include "../queue/segmented_deque.h"
+
+using T = std::uint64_t;
+
+template<typename D>
+void deque_suite(const char *label, std::size_t n, std::size_t window) {
+    char name[64];
+    T sum = 0;
+
+    {
+        D d;
+        bench::Timer t;
+        for (std::size_t i = 0; i < n; ++i) d.push_back(i);
+        while (!d.empty()) {
+            sum += d.front();
+            d.pop_front();
+        }
+        std::snprintf(name, sizeof name, "%s grow + drain", label);
+        bench::report(name, 2 * n, t.seconds());
+    }
+    {
+        D d;
+        for (std::size_t i = 0; i < window; ++i) d.push_back(i);
+        bench::Timer t;
+        for (std::size_t i = 0; i < n; ++i) {
+            d.push_back(i);
+            sum += d.front();
+            d.pop_front();
+        }
+        std::snprintf(name, sizeof name, "%s fifo (window=%zu)", label, window);
+        bench::report(name, n, t.seconds());
+    }
+    {
+        D d;
+        bench::Timer t;
+        for (std::size_t i = 0; i < n; i += 2) {
+            d.push_front(i);
+            d.push_back(i + 1);
+        }
+        while (d.size() >= 2) {
+            sum += d.front() + d.back();
+            d.pop_front();
+            d.pop_back();
+        }
+        std::snprintf(name, sizeof name, "%s both ends", label);
+        bench::report(name, 2 * n, t.seconds());
+    }
+    {
+        D d;
+        for (std::size_t i = 0; i < n; ++i) d.push_back(i);
+        bench::Timer t;
+        for (std::size_t i = 0; i < n; ++i) sum += d[i];
+        std::snprintf(name, sizeof name, "%s index", label);
+        bench::report(name, n, t.seconds());
+    }
+    bench::do_not_optimize(sum);
+}
+
+// Adapters: the repo containers return pointers where std::deque returns references.
+template<typename D>
+struct RepoDeque : D {
+    T& front() { return *this->front_ptr(); }
+    T& back() { return *this->back_ptr(); }
+};
+
+template<typename Q, typename Push, typename Pop>
+void queue_suite(const char *label, std::size_t n, std::size_t window, Q &q, Push push, Pop pop) {
+    char name[64];
+    T sum = 0;
+    for (std::size_t i = 0; i < window; ++i) push(q, i);
+    bench::Timer t;
+    for (std::size_t i = 0; i < n; ++i) {
+        push(q, i);
+        sum += pop(q);
+    }
+    std::snprintf(name, sizeof name, "%s fifo (window=%zu)", label, window);
+    bench::report(name, n, t.seconds());
+    while (q.size()) sum += pop(q);
+
+    std::size_t rounds = n / window;
+    t.reset();
+    for (std::size_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < window; ++i) push(q, i);
+        for (std::size_t i = 0; i < window; ++i) sum += pop(q);
+    }
+    std::snprintf(name, sizeof name, "%s burst (%zu)", label, window);
+    bench::report(name, 2 * rounds * window, t.seconds());
+    bench::do_not_optimize(sum);
+}
+
+int main(int argc, char **argv) {
+    std::size_t n = bench::arg_or(argc, argv, 1, 10000000);
+    std::size_t window = bench::arg_or(argc, argv, 2, 1024);
+    std::printf("n=%zu window=%zu\n", n, window);
+
+    deque_suite<RepoDeque<Deque<T>>>("Deque         ", n, window);
+    deque_suite<RepoDeque<SegmentedDeque<T>>>("SegmentedDeque", n, window);
+    deque_suite<std::deque<T>>("std::deque    ", n, window);
+
+    // window + 1 slots: the fifo loop pushes before it pops
+    ArrayQueue<T> aq(window + 1);
+    queue_suite("ArrayQueue    ", n, window, aq,
+                [](ArrayQueue<T> &q, T v) { q.enqueue(v); },
+                [](ArrayQueue<T> &q) { T v = *q.front_ptr(); q.dequeue(); return v; });
+    std::queue<T> sq;
+    queue_suite("std::queue    ", n, window, sq,
+                [](std::queue<T> &q, T v) { q.push(v); },
+                [](std::queue<T> &q) { T v = q.front(); q.pop(); return v; });
+    return 0;
+}
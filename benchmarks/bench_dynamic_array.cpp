@@ -0,0 +1,85 @@
+// DynamicArray vs std::vector: append without reserve (realloc growth for trivially
+// copyable elements vs allocate + copy), append of a non-trivial type, sequential reads,
+// and inserts in the middle.
+//
+//   g++ -std=c++17 -O2 bench_dynamic_array.cpp -o bench_dynamic_array
+//   ./bench_dynamic_array [n=10000000] [rounds=5] [inserts=20000]
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "bench_util.h"
+#include "../arrays/dynamic_array.h"
+
+struct Record {   // 64-byte trivially copyable element
+    std::uint64_t key;
+    std::uint64_t payload[7];
+};
+
+template<typename Array, typename Make>
+double append(std::size_t n, std::size_t rounds, Make make) {
+    double total = 0;
+    for (std::size_t r = 0; r < rounds; ++r) {
+        bench::Timer t;
+        Array a;
+        for (std::size_t i = 0; i < n; ++i) a.push_back(make(i));
+        bench::do_not_optimize(a.data());
+        total += t.seconds();
+    }
+    return total;
+}
+
+template<typename Array>
+double read_all(std::size_t n, std::size_t rounds) {
+    Array a;
+    for (std::size_t i = 0; i < n; ++i) a.push_back(static_cast<std::uint32_t>(i));
+    bench::Timer t;
+    std::uint64_t sum = 0;
+    for (std::size_t r = 0; r < rounds; ++r)
+        for (std::size_t i = 0; i < a.size(); ++i) sum += a[i];
+    bench::do_not_optimize(sum);
+    return t.seconds();
+}
+
+template<typename Array, typename Insert>
+double insert_middle(std::size_t inserts, Insert insert) {
+    Array a;
+    bench::Timer t;
+    for (std::size_t i = 0; i < inserts; ++i) insert(a, a.size() / 2, static_cast<std::uint32_t>(i));
+    bench::do_not_optimize(a.data());
+    return t.seconds();
+}
+
+int main(int argc, char **argv) {
+    std::size_t n = bench::arg_or(argc, argv, 1, 10000000);
+    std::size_t rounds = bench::arg_or(argc, argv, 2, 5);
+    std::size_t inserts = bench::arg_or(argc, argv, 3, 20000);
+    std::printf("n=%zu rounds=%zu inserts=%zu\n", n, rounds, inserts);
+
+    auto u32 = [](std::size_t i) { return static_cast<std::uint32_t>(i); };
+    bench::report("push_back u32        DynamicArray", n * rounds, append<DynamicArray<std::uint32_t>>(n, rounds, u32));
+    bench::report("push_back u32        std::vector", n * rounds, append<std::vector<std::uint32_t>>(n, rounds, u32));
+
+    std::size_t nr = n / 16;  // same bytes as the u32 run
+    auto rec = [](std::size_t i) { Record r{}; r.key = i; return r; };
+    bench::report("push_back Record64   DynamicArray", nr * rounds, append<DynamicArray<Record>>(nr, rounds, rec));
+    bench::report("push_back Record64   std::vector", nr * rounds, append<std::vector<Record>>(nr, rounds, rec));
+
+    std::size_t ns = n / 10;
+    auto str = [](std::size_t i) { return std::string(16 + (i & 7), 'x'); };
+    bench::report("push_back string     DynamicArray", ns * rounds, append<DynamicArray<std::string>>(ns, rounds, str));
+    bench::report("push_back string     std::vector", ns * rounds, append<std::vector<std::string>>(ns, rounds, str));
+
+    bench::report("sequential read u32  DynamicArray", n * rounds, read_all<DynamicArray<std::uint32_t>>(n, rounds));
+    bench::report("sequential read u32  std::vector", n * rounds, read_all<std::vector<std::uint32_t>>(n, rounds));
+
+    bench::report("insert middle u32    DynamicArray", inserts,
+                  insert_middle<DynamicArray<std::uint32_t>>(inserts, [](auto &a, std::size_t pos, std::uint32_t v) {
+                      a.insert(pos, v);
+                  }));
+    bench::report("insert middle u32    std::vector", inserts,
+                  insert_middle<std::vector<std::uint32_t>>(inserts, [](auto &a, std::size_t pos, std::uint32_t v) {
+                      a.insert(a.begin() + static_cast<std::ptrdiff_t>(pos), v);
+                  }));
+    return 0;
+}
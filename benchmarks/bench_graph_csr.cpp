@@ -0,0 +1,90 @@
+// GraphCSR vs GraphAdjList (one std::list node per edge) on a uniform random graph with
+// n vertices and average degree d, edges added in random order so list nodes end up
+// scattered through the heap:
+//   build      GraphCSR from the GraphAdjList (one-off conversion cost)
+//   edge scan  visit every stored edge once
+//   BFS        level-order traversal from vertex 0 (same loop for both, via neighbors())
+//   DFS        preorder from vertex 0 (GraphAdjList::dfsOrder vs dfsPreorder on the CSR)
+//
+//   g++ -std=c++17 -O2 bench_graph_csr.cpp -o bench_graph_csr
+//   ./bench_graph_csr [n=1000000] [d=8] [rounds=5]
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include "bench_util.h"
+#include "../graph/DepthFirstSearch.h"
+#include "../graph/GraphAdjList.h"
+#include "../graph/GraphCSR.h"
+
+template<typename Graph>
+std::size_t bfsVisit(const Graph &g, int start, std::vector<int> &order, std::vector<char> &seen) {
+    order.clear();
+    seen.assign(g.numVertices(), 0);
+    seen[start] = 1;
+    order.push_back(start);
+    for (std::size_t h = 0; h < order.size(); h++)
+        for (int w : g.neighbors(order[h]))
+            if (!seen[w]) {
+                seen[w] = 1;
+                order.push_back(w);
+            }
+    return order.size();
+}
+
+template<typename Graph>
+std::uint64_t edgeScan(const Graph &g) {
+    std::uint64_t sum = 0;
+    for (int v = 0; v < g.numVertices(); v++)
+        for (int w : g.neighbors(v)) sum += static_cast<std::uint64_t>(w);
+    return sum;
+}
+
+int main(int argc, char **argv) {
+    int n = static_cast<int>(bench::arg_or(argc, argv, 1, 1000000));
+    std::size_t d = bench::arg_or(argc, argv, 2, 8);
+    std::size_t rounds = bench::arg_or(argc, argv, 3, 5);
+    std::size_t m = static_cast<std::size_t>(n) * d / 2;   // undirected edges (stored twice)
+    std::printf("n=%d d=%zu edges=%zu rounds=%zu\n", n, d, m, rounds);
+
+    bench::Rng rng(11);
+    GraphAdjList adj(n);
+    for (std::size_t i = 0; i < m; i++)
+        adj.addEdge(static_cast<int>(rng.below(n)), static_cast<int>(rng.below(n)));
+
+    bench::Timer t;
+    GraphCSR csr(adj);
+    bench::report("build    GraphCSR(GraphAdjList)", csr.numEdges(), t.seconds());
+
+    std::uint64_t sink = 0;
+    t.reset();
+    for (std::size_t r = 0; r < rounds; r++) sink += edgeScan(adj);
+    bench::report("scan     GraphAdjList", rounds * csr.numEdges(), t.seconds());
+    t.reset();
+    for (std::size_t r = 0; r < rounds; r++) sink += edgeScan(csr);
+    bench::report("scan     GraphCSR", rounds * csr.numEdges(), t.seconds());
+
+    std::vector<int> order;
+    std::vector<char> seen;
+    t.reset();
+    for (std::size_t r = 0; r < rounds; r++) sink += bfsVisit(adj, 0, order, seen);
+    bench::report("BFS      GraphAdjList (edges/s)", rounds * csr.numEdges(), t.seconds());
+    t.reset();
+    for (std::size_t r = 0; r < rounds; r++) sink += bfsVisit(csr, 0, order, seen);
+    bench::report("BFS      GraphCSR (edges/s)", rounds * csr.numEdges(), t.seconds());
+
+    t.reset();
+    for (std::size_t r = 0; r < rounds; r++) {
+        adj.dfsOrder(0, order);
+        sink += order.size();
+    }
+    bench::report("DFS      GraphAdjList (edges/s)", rounds * csr.numEdges(), t.seconds());
+    t.reset();
+    for (std::size_t r = 0; r < rounds; r++) {
+        dfsPreorder(csr, 0, order);
+        sink += order.size();
+    }
+    bench::report("DFS      GraphCSR (edges/s)", rounds * csr.numEdges(), t.seconds());
+
+    bench::do_not_optimize(sink);
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Batched get_many/put_many vs scalar get/put on caches much larger than the last-level
+// cache, where every lookup is a chain of DRAM misses (bucket, map node, cache node).
+// Keys are uniform over 1.1 x capacity, so roughly 90% of lookups hit.
+//
+//   g++ -std=c++17 -O2 bench_lru_batch.cpp -o bench_lru_batch
+//   ./bench_lru_batch [entries=4194304] [ops=4000000] [batch=64]
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <utility>
+#include <vector>
+#include "bench_util.h"
+#include "../linked_list/lru_cache.h"
+#include "../linked_list/flat_lru_cache.h"
+
+using K = std::uint64_t;
+using V = std::uint64_t;
+
+template<typename Cache>
+void run(const char *label, Cache &cache, std::size_t entries, std::size_t ops, std::size_t batch) {
+    for (std::size_t i = 0; i < entries; ++i) cache.put(i, i);
+
+    bench::Rng rng(42);
+    std::size_t key_space = entries + entries / 10;
+    std::vector<K> keys(ops);
+    for (auto &k : keys) k = rng.below(key_space);
+    std::vector<std::pair<K, V>> items(ops);
+    for (std::size_t i = 0; i < ops; ++i) items[i] = {rng.below(key_space), i};
+    std::vector<std::optional<V>> out(batch);
+    char name[96];
+
+    // gets
+    bench::Timer t;
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < ops; ++i) {
+        auto v = cache.get(keys[i]);
+        if (v) sum += *v;
+    }
+    double scalar_get = t.seconds();
+    std::snprintf(name, sizeof name, "%s get        (scalar)", label);
+    bench::report(name, ops, scalar_get);
+
+    t.reset();
+    for (std::size_t i = 0; i < ops; i += batch) {
+        std::size_t n = ops - i < batch ? ops - i : batch;
+        cache.get_many(keys.data() + i, n, out.data());
+        for (std::size_t j = 0; j < n; ++j)
+            if (out[j]) sum += *out[j];
+    }
+    double batched_get = t.seconds();
+    std::snprintf(name, sizeof name, "%s get_many   (batch=%zu)", label, batch);
+    bench::report(name, ops, batched_get);
+    bench::do_not_optimize(sum);
+
+    // puts (updates plus ~10% inserts that evict)
+    t.reset();
+    for (std::size_t i = 0; i < ops; ++i) cache.put(items[i].first, items[i].second);
+    double scalar_put = t.seconds();
+    std::snprintf(name, sizeof name, "%s put        (scalar)", label);
+    bench::report(name, ops, scalar_put);
+
+    t.reset();
+    for (std::size_t i = 0; i < ops; i += batch) {
+        std::size_t n = ops - i < batch ? ops - i : batch;
+        cache.put_many(items.data() + i, n);
+    }
+    double batched_put = t.seconds();
+    std::snprintf(name, sizeof name, "%s put_many   (batch=%zu)", label, batch);
+    bench::report(name, ops, batched_put);
+
+    std::printf("%s speedup: get x%.2f  put x%.2f\n\n", label,
+                scalar_get / batched_get, scalar_put / batched_put);
+}
+
+int main(int argc, char **argv) {
+    std::size_t entries = bench::arg_or(argc, argv, 1, 1 << 22);
+    std::size_t ops = bench::arg_or(argc, argv, 2, 4000000);
+    std::size_t batch = bench::arg_or(argc, argv, 3, 64);
+    if (batch == 0) batch = 1;
+
+    std::printf("entries=%zu ops=%zu\n", entries, ops);
+    {
+        LRUCache<K, V> cache(entries);
+        run("LRUCache    ", cache, entries, ops, batch);
+    }
+    {
+        FlatLRUCache<K, V> cache(entries);
+        run("FlatLRUCache", cache, entries, ops, batch);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+// MPMCQueue throughput and enqueue -> dequeue latency for P producers x C consumers
+// (P, C = 1, 2, 4, ... up to max_threads), against a std::mutex + std::deque baseline.
+// Each item carries its enqueue timestamp; every 16th item a consumer dequeues is
+// sampled for the latency percentiles. Threads back off with yield() on a full/empty
+// queue, so oversubscribed runs (more threads than cores) still make progress.
+// Producers run flat out, so the queue sits near full and latency is mostly queueing
+// delay (about capacity x per-item time); a small capacity shows the hand-off cost.
+//
+//   g++ -std=c++17 -O2 -pthread bench_mpmc_queue.cpp -o bench_mpmc_queue
+//   ./bench_mpmc_queue [items=2000000] [max_threads=hw] [capacity=1024]
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench_util.h"
+#include "../queue/mpmc_queue.h"
+
+static std::uint64_t now_ns() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Baseline: bounded deque under one lock, same try_ interface.
+class LockedQueue {
+private:
+    std::mutex mtx_;
+    std::deque<std::uint64_t> q_;
+    std::size_t cap_;
+
+public:
+    explicit LockedQueue(std::size_t cap) : cap_(cap) {}
+    bool try_enqueue(std::uint64_t v) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (q_.size() == cap_) return false;
+        q_.push_back(v);
+        return true;
+    }
+    bool try_dequeue(std::uint64_t &out) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        if (q_.empty()) return false;
+        out = q_.front();
+        q_.pop_front();
+        return true;
+    }
+};
+
+template<typename Queue>
+void run(const char *label, std::size_t producers, std::size_t consumers, std::size_t items,
+         std::size_t capacity) {
+    Queue q(capacity);
+    std::vector<std::vector<double>> lat(consumers);
+    for (auto &l : lat) l.reserve(items / consumers / 16 + 1);
+
+    double secs = bench::run_threads(producers + consumers, [&](std::size_t tid) {
+        if (tid < producers) {
+            // producer: its share of the items (the first one takes the remainder)
+            std::size_t n = items / producers + (tid == 0 ? items % producers : 0);
+            for (std::size_t i = 0; i < n; ++i)
+                while (!q.try_enqueue(now_ns())) std::this_thread::yield();
+        } else {
+            // consumer: dequeues exactly its share, so every thread finishes
+            std::size_t c = tid - producers;
+            std::size_t n = items / consumers + (c == 0 ? items % consumers : 0);
+            std::vector<double> &l = lat[c];
+            std::uint64_t v;
+            for (std::size_t i = 0; i < n; ++i) {
+                while (!q.try_dequeue(v)) std::this_thread::yield();
+                if ((i & 15) == 0) l.push_back(static_cast<double>(now_ns() - v));
+            }
+        }
+    });
+
+    std::vector<double> all;
+    for (auto &l : lat) all.insert(all.end(), l.begin(), l.end());
+    char name[64];
+    std::snprintf(name, sizeof name, "%s P=%zu C=%zu", label, producers, consumers);
+    bench::report(name, items, secs);
+    std::printf("%-44s latency p50 %.0f ns  p99 %.0f ns  p99.9 %.0f ns\n", "",
+                bench::percentile(all, 0.50), bench::percentile(all, 0.99), bench::percentile(all, 0.999));
+}
+
+int main(int argc, char **argv) {
+    std::size_t items = bench::arg_or(argc, argv, 1, 2000000);
+    std::size_t hw = std::thread::hardware_concurrency();
+    std::size_t max_threads = bench::arg_or(argc, argv, 2, hw ? hw : 4);
+    std::size_t capacity = bench::arg_or(argc, argv, 3, 1024);
+    std::printf("items=%zu capacity=%zu hw_threads=%zu\n", items, capacity, hw);
+
+    for (std::size_t p = 1; p <= max_threads; p *= 2) {
+        for (std::size_t c = 1; c <= max_threads; c *= 2) {
+            run<MPMCQueue<std::uint64_t>>("MPMCQueue   ", p, c, items, capacity);
+            run<LockedQueue>("mutex+deque ", p, c, items, capacity);
+        }
+    }
+    return 0;
+}
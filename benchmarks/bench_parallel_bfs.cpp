@@ -0,0 +1,118 @@
+// ParallelBFS on an undirected R-MAT graph (Graph500 parameters a=0.57 b=0.19 c=0.19,
+// 2^scale vertices, edge_factor * 2^scale edges). Mops/s below is millions of traversed
+// (undirected) edges per second, i.e. MTEPS, averaged over `sources` random start vertices.
+//   sequential   GraphCSR::bfsTree
+//   scaling      ParallelBFS with the default thresholds at 1, 2, 4, ... max_threads
+//                workers, with and without the canonical-parent pass
+//   thresholds   alpha / beta sweep at max_threads, including top-down only and
+//                bottom-up as early and as long as possible; prints the levels run each way
+//
+//   g++ -std=c++17 -O2 -pthread bench_parallel_bfs.cpp -o bench_parallel_bfs
+//   ./bench_parallel_bfs [scale=20] [edge_factor=16] [max_threads=hw] [sources=8]
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "bench_util.h"
+#include "../graph/GraphCSR.h"
+#include "../graph/ParallelBFS.h"
+
+static std::vector<std::pair<int, int>> rmatEdges(int scale, std::size_t edges, std::uint64_t seed) {
+    bench::Rng rng(seed);
+    std::vector<std::pair<int, int>> out(edges);
+    const double a = 0.57, b = 0.19, c = 0.19;
+    for (auto &e : out) {
+        int u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            double r = static_cast<double>(rng.next() >> 11) * (1.0 / 9007199254740992.0);
+            if (r < a) {
+            } else if (r < a + b) {
+                v |= 1 << bit;
+            } else if (r < a + b + c) {
+                u |= 1 << bit;
+            } else {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+        }
+        e = {u, v};
+    }
+    // scramble ids so the high-degree vertices are not all at the low end
+    std::vector<int> perm(std::size_t(1) << scale);
+    for (std::size_t i = 0; i < perm.size(); i++) perm[i] = static_cast<int>(i);
+    for (std::size_t i = perm.size() - 1; i > 0; i--) std::swap(perm[i], perm[rng.below(i + 1)]);
+    for (auto &e : out) e = {perm[e.first], perm[e.second]};
+    return out;
+}
+
+int main(int argc, char **argv) {
+    int scale = static_cast<int>(bench::arg_or(argc, argv, 1, 20));
+    std::size_t edgeFactor = bench::arg_or(argc, argv, 2, 16);
+    std::size_t hw = std::thread::hardware_concurrency();
+    std::size_t maxThreads = bench::arg_or(argc, argv, 3, hw ? hw : 4);
+    std::size_t sources = bench::arg_or(argc, argv, 4, 8);
+
+    int n = 1 << scale;
+    GraphCSR g(n, rmatEdges(scale, edgeFactor * static_cast<std::size_t>(n), 5));
+    std::size_t undirected = g.numEdges() / 2;
+    std::printf("scale=%d vertices=%d edges=%zu sources=%zu hw_threads=%zu\n", scale, n, undirected, sources, hw);
+
+    // start vertices with at least one edge, so every run explores the giant component
+    bench::Rng rng(9);
+    std::vector<int> starts;
+    while (starts.size() < sources) {
+        int s = static_cast<int>(rng.below(n));
+        if (g.degree(s) > 0) starts.push_back(s);
+    }
+
+    std::uint64_t sink = 0;
+    bench::Timer t;
+    for (int s : starts) sink += static_cast<std::uint64_t>(g.bfsTree(s).first[s] + 1);
+    bench::report("sequential GraphCSR::bfsTree", sources * undirected, t.seconds());
+
+    char name[80];
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        WorkStealingPool pool(threads);
+        ParallelBFS bfs(g, pool);
+        for (bool canonical : {false, true}) {
+            t.reset();
+            for (int s : starts) sink += static_cast<std::uint64_t>(bfs.run(s, canonical).first[s] + 1);
+            std::snprintf(name, sizeof name, "ParallelBFS threads=%zu%s", threads, canonical ? " canonical" : "");
+            bench::report(name, sources * undirected, t.seconds());
+        }
+    }
+
+    struct Setting {
+        const char *label;
+        double alpha, beta;
+    };
+    const Setting settings[] = {
+        {"top-down only", 1e-300, 1.0},       // frontierEdges never exceeds unexplored / 1e-300
+        {"alpha=2  beta=24", 2.0, 24.0},
+        {"alpha=14 beta=24 (default)", 14.0, 24.0},
+        {"alpha=50 beta=24", 50.0, 24.0},
+        {"alpha=14 beta=4", 14.0, 4.0},
+        {"alpha=14 beta=100", 14.0, 100.0},
+        {"bottom-up asap, stay", 1e300, 1e300},
+    };
+    WorkStealingPool pool(maxThreads);
+    ParallelBFS bfs(g, pool);
+    for (const Setting &st : settings) {
+        bfs.setThresholds(st.alpha, st.beta);
+        int td = 0, bu = 0;
+        t.reset();
+        for (int s : starts) {
+            sink += static_cast<std::uint64_t>(bfs.run(s, false).first[s] + 1);
+            td += bfs.lastTopDownSteps();
+            bu += bfs.lastBottomUpSteps();
+        }
+        double secs = t.seconds();
+        std::snprintf(name, sizeof name, "%s (td %.1f / bu %.1f)", st.label,
+                      static_cast<double>(td) / static_cast<double>(sources),
+                      static_cast<double>(bu) / static_cast<double>(sources));
+        bench::report(name, sources * undirected, secs);
+    }
+    bench::do_not_optimize(sink);
+    return 0;
+}
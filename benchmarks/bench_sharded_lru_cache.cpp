@@ -0,0 +1,82 @@
+// Multi-threaded throughput: ShardedLRUCache vs one LRUCache behind a single mutex.
+// Each thread runs a get-heavy mix (get, put on miss, plus a share of plain puts) over
+// Zipf-distributed keys from a key space twice the cache capacity.
+//
+//   g++ -std=c++17 -O2 -pthread bench_sharded_lru_cache.cpp -o bench_sharded_lru_cache
+//   ./bench_sharded_lru_cache [ops_per_thread=1000000] [max_threads=2*hw] [capacity=100000]
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bench_util.h"
+#include "../linked_list/lru_cache.h"
+#include "../linked_list/sharded_lru_cache.h"
+
+// Baseline: the whole cache under one lock.
+class GlobalLockLRU {
+private:
+    std::mutex mtx_;
+    LRUCache<std::uint64_t, std::uint64_t> cache_;
+
+public:
+    explicit GlobalLockLRU(std::size_t cap) : cache_(cap) {}
+    std::optional<std::uint64_t> get(std::uint64_t k) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        return cache_.get(k);
+    }
+    void put(std::uint64_t k, std::uint64_t v) {
+        std::lock_guard<std::mutex> lock(mtx_);
+        cache_.put(k, v);
+    }
+};
+
+template<typename Cache>
+double run_mix(Cache &cache, std::size_t threads, std::size_t ops,
+               const std::vector<std::vector<std::uint64_t>> &keys) {
+    return bench::run_threads(threads, [&](std::size_t t) {
+        const std::vector<std::uint64_t> &ks = keys[t];
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < ops; ++i) {
+            std::uint64_t k = ks[i % ks.size()];
+            if ((i & 15) == 0) {            // ~6% blind writes
+                cache.put(k, i);
+                continue;
+            }
+            auto v = cache.get(k);
+            if (v) sum += *v;
+            else cache.put(k, i);
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+int main(int argc, char **argv) {
+    std::size_t ops = bench::arg_or(argc, argv, 1, 1000000);
+    std::size_t hw = std::thread::hardware_concurrency();
+    std::size_t max_threads = bench::arg_or(argc, argv, 2, hw ? 2 * hw : 8);
+    std::size_t capacity = bench::arg_or(argc, argv, 3, 100000);
+
+    // per-thread key streams, precomputed so sampling doesn't show up in the timings
+    std::vector<std::vector<std::uint64_t>> keys(max_threads);
+    for (std::size_t t = 0; t < max_threads; ++t) {
+        bench::ZipfGenerator zipf(capacity * 2, 0.99, t + 1);
+        keys[t].resize(1 << 16);
+        for (auto &k : keys[t]) k = zipf.next();
+    }
+
+    std::printf("ops/thread=%zu capacity=%zu hw_threads=%zu\n", ops, capacity, hw);
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        char name[64];
+        GlobalLockLRU global(capacity);
+        double s1 = run_mix(global, threads, ops, keys);
+        std::snprintf(name, sizeof name, "global-lock LRUCache   threads=%zu", threads);
+        bench::report(name, ops * threads, s1);
+
+        ShardedLRUCache<std::uint64_t, std::uint64_t> sharded(capacity);
+        double s2 = run_mix(sharded, threads, ops, keys);
+        std::snprintf(name, sizeof name, "ShardedLRUCache(%zu)  threads=%zu", sharded.shard_count(), threads);
+        bench::report(name, ops * threads, s2);
+    }
+    return 0;
+}
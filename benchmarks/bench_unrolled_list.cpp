@@ -0,0 +1,103 @@
+// UnrolledLinkedList vs DoublyLinkedList (one node per element) vs std::vector:
+//   build      push_back n elements
+//   traverse   sum all elements, `rounds` passes (list nodes are allocated interleaved
+//              with filler blocks so they are not laid out back to back, as in a
+//              long-running process)
+//   insert     `inserts` insert_at at uniform random positions into a list of m elements
+//
+//   g++ -std=c++17 -O2 bench_unrolled_list.cpp -o bench_unrolled_list
+//   ./bench_unrolled_list [n=4000000] [rounds=10] [m=100000] [inserts=20000]
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "bench_util.h"
+#include "../linked_list/doubly_linked_list.h"
+#include "../linked_list/unrolled_linked_list.h"
+
+using T = std::uint64_t;
+
+// push_back n elements, allocating a throwaway block between pushes
+template<typename List>
+void fill_scattered(List &l, std::size_t n, std::vector<std::unique_ptr<char[]>> &filler) {
+    for (std::size_t i = 0; i < n; ++i) {
+        l.push_back(i);
+        filler.emplace_back(new char[48]);
+    }
+}
+
+std::uint64_t sum(const UnrolledLinkedList<T> &l) {
+    std::uint64_t s = 0;
+    l.for_each([&](const T &v) { s += v; });
+    return s;
+}
+
+std::uint64_t sum(const DoublyLinkedList<T> &l) {
+    std::uint64_t s = 0;
+    for (auto *n = l.get_head(); n; n = n->next) s += n->val;
+    return s;
+}
+
+std::uint64_t sum(const std::vector<T> &v) {
+    std::uint64_t s = 0;
+    for (T x : v) s += x;
+    return s;
+}
+
+template<typename List>
+double build(std::size_t n) {
+    bench::Timer t;
+    List l;
+    for (std::size_t i = 0; i < n; ++i) l.push_back(i);
+    bench::do_not_optimize(l.size());
+    return t.seconds();
+}
+
+template<typename List>
+double traverse(std::size_t n, std::size_t rounds) {
+    List l;
+    std::vector<std::unique_ptr<char[]>> filler;
+    filler.reserve(n);
+    fill_scattered(l, n, filler);
+    filler.clear();
+    bench::Timer t;
+    std::uint64_t s = 0;
+    for (std::size_t r = 0; r < rounds; ++r) s += sum(l);
+    bench::do_not_optimize(s);
+    return t.seconds();
+}
+
+template<typename List, typename Insert>
+double insert_random(std::size_t m, std::size_t inserts, Insert insert) {
+    List l;
+    for (std::size_t i = 0; i < m; ++i) l.push_back(i);
+    bench::Rng rng(3);
+    bench::Timer t;
+    for (std::size_t i = 0; i < inserts; ++i) insert(l, rng.below(l.size() + 1), i);
+    bench::do_not_optimize(l.size());
+    return t.seconds();
+}
+
+int main(int argc, char **argv) {
+    std::size_t n = bench::arg_or(argc, argv, 1, 4000000);
+    std::size_t rounds = bench::arg_or(argc, argv, 2, 10);
+    std::size_t m = bench::arg_or(argc, argv, 3, 100000);
+    std::size_t inserts = bench::arg_or(argc, argv, 4, 20000);
+    std::printf("n=%zu rounds=%zu m=%zu inserts=%zu\n", n, rounds, m, inserts);
+
+    bench::report("build    UnrolledLinkedList", n, build<UnrolledLinkedList<T>>(n));
+    bench::report("build    DoublyLinkedList", n, build<DoublyLinkedList<T>>(n));
+    bench::report("build    std::vector", n, build<std::vector<T>>(n));
+
+    bench::report("traverse UnrolledLinkedList", n * rounds, traverse<UnrolledLinkedList<T>>(n, rounds));
+    bench::report("traverse DoublyLinkedList", n * rounds, traverse<DoublyLinkedList<T>>(n, rounds));
+
+    auto list_insert = [](auto &l, std::size_t pos, T v) { l.insert_at(pos, v); };
+    bench::report("insert   UnrolledLinkedList", inserts, insert_random<UnrolledLinkedList<T>>(m, inserts, list_insert));
+    bench::report("insert   DoublyLinkedList", inserts, insert_random<DoublyLinkedList<T>>(m, inserts, list_insert));
+    bench::report("insert   std::vector", inserts,
+                  insert_random<std::vector<T>>(m, inserts, [](auto &v, std::size_t pos, T x) {
+                      v.insert(v.begin() + static_cast<std::ptrdiff_t>(pos), x);
+                  }));
+    return 0;
+}
@@ -0,0 +1,130 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/*
+  bench_util.h
+  - Small helpers shared by the standalone benchmark drivers in this directory
+    (each bench_*.cpp has its own main(), like the demos in graph/graphAlgos).
+  - Methods:
+      Timer t; t.seconds() / t.reset()                 // steady_clock stopwatch
+      do_not_optimize(v)                               // keep v (and its computation) alive
+      size_t arg_or(argc, argv, i, default)            // argv[i] as a number, or default
+      Rng r(seed); r.next() / r.below(n)               // xorshift64* (fast, reproducible)
+      ZipfGenerator z(n, s, seed); z.next()            // keys in [0, n) with a Zipf(s) skew
+      double percentile(vector<double>& v, p)          // sorts v; p in [0, 1]
+      double run_threads(n, f)                         // f(tid) on n threads started together;
+                                                       // returns wall seconds
+      void report(name, ops, seconds)                  // one aligned "Mops/s  ns/op" line
+*/
+
+namespace bench {
+
+class Timer {
+private:
+    std::chrono::steady_clock::time_point start_;
+
+public:
+    Timer() : start_(std::chrono::steady_clock::now()) {}
+    void reset() { start_ = std::chrono::steady_clock::now(); }
+    double seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+};
+
+template<typename T>
+inline void do_not_optimize(const T &v) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&v) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &v;
+#endif
+}
+
+inline std::size_t arg_or(int argc, char **argv, int i, std::size_t def) {
+    if (i < argc) return static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10));
+    return def;
+}
+
+struct Rng {
+    std::uint64_t s;
+    explicit Rng(std::uint64_t seed = 0x9E3779B97F4A7C15ull) : s(seed ? seed : 1) {}
+    std::uint64_t next() {
+        s ^= s >> 12;
+        s ^= s << 25;
+        s ^= s >> 27;
+        return s * 0x2545F4914F6CDD1Dull;
+    }
+    std::uint64_t below(std::uint64_t n) { return next() % n; }
+};
+
+// Inverse-CDF sampling over a precomputed table (n doubles), good enough for cache workloads.
+class ZipfGenerator {
+private:
+    std::vector<double> cdf_;
+    Rng rng_;
+
+public:
+    ZipfGenerator(std::size_t n, double s, std::uint64_t seed = 1) : cdf_(n), rng_(seed) {
+        double sum = 0;
+        for (std::size_t i = 0; i < n; ++i) sum += 1.0 / std::pow(static_cast<double>(i + 1), s);
+        double acc = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            acc += 1.0 / std::pow(static_cast<double>(i + 1), s) / sum;
+            cdf_[i] = acc;
+        }
+    }
+    std::size_t next() {
+        double u = static_cast<double>(rng_.next() >> 11) * (1.0 / 9007199254740992.0);
+        std::size_t i = static_cast<std::size_t>(std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin());
+        return i < cdf_.size() ? i : cdf_.size() - 1;
+    }
+};
+
+inline double percentile(std::vector<double> &v, double p) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    std::size_t i = static_cast<std::size_t>(p * static_cast<double>(v.size() - 1));
+    return v[i];
+}
+
+template<typename F>
+double run_threads(std::size_t n, F &&f) {
+    std::atomic<std::size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    for (std::size_t t = 0; t < n; ++t) {
+        threads.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            f(t);
+        });
+    }
+    while (ready.load() != n) std::this_thread::yield();
+    Timer timer;
+    go.store(true, std::memory_order_release);
+    for (auto &th : threads) th.join();
+    return timer.seconds();
+}
+
+inline void report(const char *name, std::size_t ops, double seconds) {
+    double mops = seconds > 0 ? static_cast<double>(ops) / seconds / 1e6 : 0;
+    double ns = ops ? seconds * 1e9 / static_cast<double>(ops) : 0;
+    std::printf("%-44s %10.2f Mops/s %10.2f ns/op\n", name, mops, ns);
+}
+
+} // namespace bench
+
+#endif // BENCH_UTIL_H
@@ -0,0 +1,25 @@
+#ifndef BIT_UTILS_H
+#define BIT_UTILS_H
+
+#include <cstddef>
+
+/*
+  bit_utils.h
+  - Bit helpers shared by the containers that size power-of-two tables
+    (ring buffers, hash tables, shard arrays) so they can index with `& (n - 1)`.
+  - Function (namespace bitutil):
+      size_t next_pow2(size_t x)     // smallest power of two >= x (1 for x == 0)
+*/
+
+namespace bitutil {
+
+    constexpr std::size_t next_pow2(std::size_t x) {
+        if (x == 0) return 1;
+        --x;
+        for (std::size_t i = 1; i < sizeof(std::size_t) * 8; i <<= 1) x |= x >> i;
+        return ++x;
+    }
+
+} // namespace bitutil
+
+#endif // BIT_UTILS_H
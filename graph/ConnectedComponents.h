@@ -0,0 +1,291 @@
+#ifndef CONNECTED_COMPONENTS_H
+#define CONNECTED_COMPONENTS_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include "GraphCSR.h"
+#include "../queue/work_stealing_pool.h"
+
+// Connected-component labelling for undirected graphs.
+// Every routine returns one id per vertex, and the id of a component is the smallest vertex
+// id in it, so results from different algorithms compare equal with ==.
+//
+//   UnionFind               sequential, union by size + path halving; incremental
+//   ConcurrentUnionFind     lock-free, safe to unite()/find() from many threads at once;
+//                           incremental (addEdges batches run on a WorkStealingPool)
+//   componentsUnionFind     label a GraphCSR (sequential or parallel)
+//   componentsFromEdges     label an edge stream in parallel
+//   componentsAfforest      Afforest (Sutton et al.): Shiloach–Vishkin style hooking on a
+//                           few sampled neighbours per vertex, then skips the vertices of the
+//                           (usually giant) component found so far
+//
+// Adjacency lists convert with GraphCSR(adj) or GraphCSR(GraphAdjList). CSR inputs must be
+// symmetric (each undirected edge stored both ways), which is what GraphCSR builds by default.
+
+// ==========================
+// Sequential union-find
+// ==========================
+class UnionFind {
+private:
+    std::vector<int> parent;
+    std::vector<int> sz;
+    int components;
+
+public:
+    UnionFind(int n) : parent(n), sz(n, 1), components(n) {
+        for (int i = 0; i < n; i++) parent[i] = i;
+    }
+
+    int size() const { return static_cast<int>(parent.size()); }
+    int componentCount() const { return components; }
+
+    // Root of x (path halving: every other node on the path skips to its grandparent)
+    int find(int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // Merge the sets of a and b (smaller under larger); false if already together
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (sz[a] < sz[b]) std::swap(a, b);
+        parent[b] = a;
+        sz[a] += sz[b];
+        components--;
+        return true;
+    }
+
+    bool connected(int a, int b) { return find(a) == find(b); }
+    int componentSize(int x) { return sz[find(x)]; }
+
+    // Component id per vertex (smallest vertex id of the component)
+    std::vector<int> labels() {
+        int n = size();
+        std::vector<int> minOf(n, n), out(n);
+        for (int v = 0; v < n; v++) {
+            int r = find(v);
+            if (v < minOf[r]) minOf[r] = v;
+        }
+        for (int v = 0; v < n; v++) out[v] = minOf[find(v)];
+        return out;
+    }
+};
+
+// ==========================
+// Lock-free union-find
+// ==========================
+// Roots are linked by index (the larger id hangs under the smaller one) with a single CAS;
+// unlike union by size this needs no second word updated atomically, and it makes the
+// root of every set its smallest member. find() compresses with CAS path halving.
+class ConcurrentUnionFind {
+private:
+    int n;
+    std::unique_ptr<std::atomic<int>[]> parent;
+    std::atomic<int> components;
+
+public:
+    ConcurrentUnionFind(int vertices)
+        : n(vertices), parent(new std::atomic<int>[vertices]), components(vertices) {
+        for (int i = 0; i < n; i++) parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    int size() const { return n; }
+    int componentCount() const { return components.load(std::memory_order_relaxed); }
+
+    int find(int x) {
+        for (;;) {
+            int p = parent[x].load(std::memory_order_relaxed);
+            if (p == x) return x;
+            int gp = parent[p].load(std::memory_order_relaxed);
+            if (gp != p) parent[x].compare_exchange_weak(p, gp, std::memory_order_relaxed);  // halve
+            x = gp;
+        }
+    }
+
+    // Thread-safe; returns true for exactly one of several racing calls that join two sets
+    bool unite(int a, int b) {
+        for (;;) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (a > b) std::swap(a, b);
+            int expected = b;
+            if (parent[b].compare_exchange_strong(expected, a, std::memory_order_acq_rel)) {
+                components.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            // b stopped being a root meanwhile: retry from the new roots
+        }
+    }
+
+    // Exact once no unite() is running concurrently
+    bool connected(int a, int b) { return find(a) == find(b); }
+
+    // Incremental mode: insert a batch of edges in parallel
+    void addEdges(const std::vector<std::pair<int, int>> &edges, WorkStealingPool &pool) {
+        pool.parallel_for(0, edges.size(), [&](std::size_t i) {
+            const std::pair<int, int> &e = edges[i];
+            if (e.first >= 0 && e.first < n && e.second >= 0 && e.second < n) unite(e.first, e.second);
+        });
+    }
+
+    // Component id per vertex (the root, which is the smallest vertex id)
+    std::vector<int> labels() {
+        std::vector<int> out(n);
+        for (int v = 0; v < n; v++) out[v] = find(v);
+        return out;
+    }
+
+    std::vector<int> labels(WorkStealingPool &pool) {
+        std::vector<int> out(n);
+        pool.parallel_for(0, static_cast<std::size_t>(n), [&](std::size_t v) { out[v] = find(static_cast<int>(v)); });
+        return out;
+    }
+};
+
+// ==========================
+// Whole-graph labelling
+// ==========================
+inline std::vector<int> componentsUnionFind(const GraphCSR &g) {
+    UnionFind uf(g.numVertices());
+    const std::vector<std::size_t> &off = g.rowOffsets();
+    const std::vector<int> &tgt = g.columnTargets();
+    for (int v = 0; v < g.numVertices(); v++)
+        for (std::size_t e = off[v]; e < off[v + 1]; e++)
+            if (tgt[e] > v) uf.unite(v, tgt[e]);   // each undirected edge once
+    return uf.labels();
+}
+
+inline std::vector<int> componentsUnionFind(const GraphCSR &g, WorkStealingPool &pool) {
+    ConcurrentUnionFind uf(g.numVertices());
+    const std::vector<std::size_t> &off = g.rowOffsets();
+    const std::vector<int> &tgt = g.columnTargets();
+    pool.parallel_for(0, static_cast<std::size_t>(g.numVertices()), [&](std::size_t v) {
+        for (std::size_t e = off[v]; e < off[v + 1]; e++)
+            if (tgt[e] > static_cast<int>(v)) uf.unite(static_cast<int>(v), tgt[e]);
+    });
+    return uf.labels(pool);
+}
+
+inline std::vector<int> componentsFromEdges(int vertices, const std::vector<std::pair<int, int>> &edges,
+                                            WorkStealingPool &pool) {
+    ConcurrentUnionFind uf(vertices);
+    uf.addEdges(edges, pool);
+    return uf.labels(pool);
+}
+
+// Number of distinct components in a label vector
+inline int countComponents(const std::vector<int> &labels) {
+    int count = 0;
+    for (std::size_t v = 0; v < labels.size(); v++)
+        if (labels[v] == static_cast<int>(v)) count++;
+    return count;
+}
+
+// ==========================
+// Afforest
+// ==========================
+class Afforest {
+private:
+    const GraphCSR &g;
+    WorkStealingPool &pool;
+    std::unique_ptr<std::atomic<int>[]> comp;
+
+    int load(int v) const { return comp[v].load(std::memory_order_relaxed); }
+
+    // Hook the tree of the larger root under the smaller one (Shiloach–Vishkin style)
+    void link(int u, int v) {
+        int p1 = load(u);
+        int p2 = load(v);
+        while (p1 != p2) {
+            int high = std::max(p1, p2);
+            int low = std::min(p1, p2);
+            int pHigh = load(high);
+            if (pHigh == low) break;                    // already hooked there
+            if (pHigh == high) {
+                int expected = high;
+                if (comp[high].compare_exchange_strong(expected, low, std::memory_order_relaxed)) break;
+            }
+            p1 = load(load(high));
+            p2 = load(low);
+        }
+    }
+
+    // Point every vertex straight at its root
+    void compress() {
+        pool.parallel_for(0, static_cast<std::size_t>(g.numVertices()), [&](std::size_t i) {
+            int v = static_cast<int>(i);
+            while (load(v) != load(load(v))) comp[v].store(load(load(v)), std::memory_order_relaxed);
+        });
+    }
+
+    // Most frequent label among a fixed sample of vertices
+    int sampleLargest(int samples) const {
+        int n = g.numVertices();
+        std::unordered_map<int, int> counts;
+        std::uint64_t x = 0x9E3779B97F4A7C15ull;   // fixed seed: deterministic output
+        int best = load(0), bestCount = 0;
+        for (int i = 0; i < samples; i++) {
+            x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+            int c = load(static_cast<int>(x % static_cast<std::uint64_t>(n)));
+            int k = ++counts[c];
+            if (k > bestCount) { bestCount = k; best = c; }
+        }
+        return best;
+    }
+
+public:
+    Afforest(const GraphCSR &graph, WorkStealingPool &workers)
+        : g(graph), pool(workers), comp(new std::atomic<int>[graph.numVertices()]) {}
+
+    std::vector<int> run(int neighborRounds = 2) {
+        int n = g.numVertices();
+        std::vector<int> out(n);
+        if (n == 0) return out;
+        const std::vector<std::size_t> &off = g.rowOffsets();
+        const std::vector<int> &tgt = g.columnTargets();
+
+        pool.parallel_for(0, static_cast<std::size_t>(n), [&](std::size_t v) {
+            comp[v].store(static_cast<int>(v), std::memory_order_relaxed);
+        });
+
+        // 1) hook along the first few neighbours of every vertex: usually enough to
+        //    assemble most of the giant component
+        for (int r = 0; r < neighborRounds; r++) {
+            pool.parallel_for(0, static_cast<std::size_t>(n), [&](std::size_t v) {
+                if (off[v] + r < off[v + 1]) link(static_cast<int>(v), tgt[off[v] + r]);
+            });
+            compress();
+        }
+
+        // 2) the rest of the edges, skipping vertices already in the sampled giant component
+        //    (their remaining edges are seen from the other endpoint, the graph is symmetric)
+        int giant = sampleLargest(1024);
+        pool.parallel_for(0, static_cast<std::size_t>(n), [&](std::size_t v) {
+            if (load(static_cast<int>(v)) == giant) return;
+            for (std::size_t e = off[v] + neighborRounds; e < off[v + 1]; e++)
+                link(static_cast<int>(v), tgt[e]);
+        });
+        compress();
+
+        pool.parallel_for(0, static_cast<std::size_t>(n), [&](std::size_t v) { out[v] = load(static_cast<int>(v)); });
+        return out;
+    }
+};
+
+inline std::vector<int> componentsAfforest(const GraphCSR &g, WorkStealingPool &pool, int neighborRounds = 2) {
+    return Afforest(g, pool).run(neighborRounds);
+}
+
+#endif // CONNECTED_COMPONENTS_H
@@ -0,0 +1,239 @@
+#ifndef DEPTH_FIRST_SEARCH_H
+#define DEPTH_FIRST_SEARCH_H
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+// Reusable iterative DFS. The recursion is replaced by an explicit stack of
+// (vertex, edge cursor) frames, so a path of millions of vertices costs one small frame
+// per vertex instead of a call-stack frame each. Vertices and edges are reported to a
+// visitor, in exactly the order a recursive DFS would see them:
+//
+//   discover(v)              v first reached (preorder)
+//   finish(v)                all of v's edges explored (postorder)
+//   treeEdge(u, v)           v reached for the first time through u -> v
+//   backEdge(u, v)           v is still on the stack (a cycle in a directed graph)
+//   forwardOrCrossEdge(u, v) v already finished
+//   stop()                   polled once per step; return true to abandon the search
+//
+// Derive from DfsVisitor and hide only the hooks you need; the rest are empty inlines.
+// The engine keeps its colour array and frame stack between runs, and the algorithms
+// below write into caller-owned vectors (clear/assign keep their capacity).
+//
+// Graph needs a dfsNumVertices(g) overload and a way to walk the edges of a vertex:
+// either dfsDegree(g, v) / dfsNeighbor(g, v, i) for random-access rows (the default
+// DfsCursor below), or a DfsCursor<Graph> specialization for rows that are lists or
+// matrix rows. GraphCSR, GraphAdjList, GraphAdjMatrix and GraphBitMatrix supply theirs in
+// their own headers; adjacency vectors (std::vector<std::vector<int>>) are handled here.
+
+inline int dfsNumVertices(const std::vector<std::vector<int>> &adj) { return static_cast<int>(adj.size()); }
+inline std::size_t dfsDegree(const std::vector<std::vector<int>> &adj, int v) { return adj[v].size(); }
+inline int dfsNeighbor(const std::vector<std::vector<int>> &adj, int v, std::size_t i) { return adj[v][i]; }
+
+// Position in the edges of one vertex: next() returns the next neighbour of v, or -1 once
+// every edge has been returned. Constructed when v is discovered.
+template<typename Graph>
+struct DfsCursor {
+    std::size_t i = 0;
+    DfsCursor(const Graph &, int) {}
+    int next(const Graph &g, int v) { return i < dfsDegree(g, v) ? dfsNeighbor(g, v, i++) : -1; }
+};
+
+struct DfsVisitor {
+    void discover(int) {}
+    void finish(int) {}
+    void treeEdge(int, int) {}
+    void backEdge(int, int) {}
+    void forwardOrCrossEdge(int, int) {}
+    bool stop() const { return false; }
+};
+
+template<typename Graph>
+class DepthFirstSearch {
+public:
+    enum Color : unsigned char { WHITE, GRAY, BLACK };   // unseen / on the stack / finished
+
+private:
+    struct Frame {
+        int v;
+        DfsCursor<Graph> edges;   // next edge of v to explore
+    };
+
+    const Graph &g;
+    int V;
+    std::vector<unsigned char> color;
+    std::vector<Frame> stack;
+
+public:
+    explicit DepthFirstSearch(const Graph &graph) : g(graph), V(dfsNumVertices(graph)), color(V, WHITE) {
+        stack.reserve(V);
+    }
+
+    int numVertices() const { return V; }
+    Color state(int v) const { return static_cast<Color>(color[v]); }
+    bool visited(int v) const { return color[v] != WHITE; }
+
+    // Forget every visited vertex (buffers keep their size)
+    void reset() { std::fill(color.begin(), color.end(), static_cast<unsigned char>(WHITE)); }
+
+    // Search from start; vertices visited by earlier runs are not entered again, so
+    // successive calls build a DFS forest. Returns false if the visitor stopped it
+    // (the vertices left on the stack stay GRAY).
+    template<typename Visitor>
+    bool run(int start, Visitor &vis) {
+        if (start < 0 || start >= V || color[start] != WHITE) return true;
+        color[start] = GRAY;
+        vis.discover(start);
+        stack.push_back({start, DfsCursor<Graph>(g, start)});
+        while (!stack.empty()) {
+            if (vis.stop()) {
+                stack.clear();
+                return false;
+            }
+            Frame &f = stack.back();
+            int u = f.v;
+            int w = f.edges.next(g, u);
+            if (w < 0) {
+                stack.pop_back();
+                color[u] = BLACK;
+                vis.finish(u);
+                continue;
+            }
+            if (color[w] == WHITE) {
+                vis.treeEdge(u, w);
+                color[w] = GRAY;
+                vis.discover(w);
+                stack.push_back({w, DfsCursor<Graph>(g, w)});    // f is invalid from here on
+            } else if (color[w] == GRAY) {
+                vis.backEdge(u, w);
+            } else {
+                vis.forwardOrCrossEdge(u, w);
+            }
+        }
+        return true;
+    }
+
+    // Search from every unvisited vertex in ascending order (the whole DFS forest)
+    template<typename Visitor>
+    bool runAll(Visitor &vis) {
+        for (int v = 0; v < V; v++)
+            if (color[v] == WHITE && !run(v, vis)) return false;
+        return true;
+    }
+};
+
+// ==========================
+// Algorithms on the engine
+// ==========================
+
+// Vertices reachable from start, in DFS preorder
+template<typename Graph>
+void dfsPreorder(const Graph &g, int start, std::vector<int> &order) {
+    struct Visitor : DfsVisitor {
+        std::vector<int> &out;
+        explicit Visitor(std::vector<int> &o) : out(o) {}
+        void discover(int v) { out.push_back(v); }
+    } vis(order);
+    order.clear();
+    DepthFirstSearch<Graph> dfs(g);
+    dfs.run(start, vis);
+}
+
+// Reverse postorder of the whole forest (roots tried in ascending order).
+// For a DAG this is a topological order; returns false if the graph has a cycle,
+// in which case order is still filled but is not topological.
+template<typename Graph>
+bool topologicalSort(const Graph &g, std::vector<int> &order) {
+    struct Visitor : DfsVisitor {
+        std::vector<int> &out;
+        std::size_t pos;
+        bool cyclic = false;
+        Visitor(std::vector<int> &o, std::size_t n) : out(o), pos(n) {}
+        void finish(int v) { out[--pos] = v; }
+        void backEdge(int, int) { cyclic = true; }
+    };
+    int n = dfsNumVertices(g);
+    order.assign(n, -1);
+    Visitor vis(order, static_cast<std::size_t>(n));
+    DepthFirstSearch<Graph> dfs(g);
+    dfs.runAll(vis);
+    return !vis.cyclic;
+}
+
+// Cycle detection. With directed == false every edge must be stored both ways; the edge
+// back to a vertex's DFS parent is skipped once (a second copy is a cycle of length 2).
+template<typename Graph>
+bool hasCycle(const Graph &g, bool directed = true) {
+    struct Visitor : DfsVisitor {
+        bool directed;
+        bool found = false;
+        std::vector<int> parent;
+        std::vector<unsigned char> skippedParent;
+        Visitor(int n, bool d) : directed(d) {
+            if (!d) {
+                parent.assign(n, -1);
+                skippedParent.assign(n, 0);
+            }
+        }
+        void treeEdge(int u, int v) { if (!directed) parent[v] = u; }
+        void backEdge(int u, int v) {
+            if (!directed && v == parent[u] && !skippedParent[u]) skippedParent[u] = 1;
+            else found = true;
+        }
+        bool stop() const { return found; }
+    };
+    Visitor vis(dfsNumVertices(g), directed);
+    DepthFirstSearch<Graph> dfs(g);
+    dfs.runAll(vis);
+    return vis.found;
+}
+
+// Tarjan's strongly connected components. comp[v] receives the component id of v;
+// ids are numbered in the order Tarjan completes them, which is a reverse topological
+// order of the condensation (sink components first). Returns the number of components.
+template<typename Graph>
+int stronglyConnectedComponents(const Graph &g, std::vector<int> &comp) {
+    struct Visitor : DfsVisitor {
+        std::vector<int> &comp;
+        std::vector<int> index, low, parent, pending;
+        std::vector<unsigned char> onStack;
+        int counter = 0;
+        int components = 0;
+        Visitor(std::vector<int> &c, int n)
+            : comp(c), index(n, -1), low(n, 0), parent(n, -1), onStack(n, 0) {
+            pending.reserve(n);
+        }
+        void discover(int v) {
+            index[v] = low[v] = counter++;
+            pending.push_back(v);
+            onStack[v] = 1;
+        }
+        void treeEdge(int u, int v) { parent[v] = u; }
+        void backEdge(int u, int v) { low[u] = std::min(low[u], index[v]); }
+        void forwardOrCrossEdge(int u, int v) {
+            if (onStack[v]) low[u] = std::min(low[u], index[v]);
+        }
+        void finish(int v) {
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = pending.back();
+                    pending.pop_back();
+                    onStack[w] = 0;
+                    comp[w] = components;
+                } while (w != v);
+                components++;
+            }
+            if (parent[v] >= 0) low[parent[v]] = std::min(low[parent[v]], low[v]);
+        }
+    };
+    int n = dfsNumVertices(g);
+    comp.assign(n, -1);
+    Visitor vis(comp, n);
+    DepthFirstSearch<Graph> dfs(g);
+    dfs.runAll(vis);
+    return vis.components;
+}
+
+#endif // DEPTH_FIRST_SEARCH_H
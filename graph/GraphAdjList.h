@@ -5,29 +5,25 @@
 #include <vector>
 #include <list>
 #include <queue>
+#include <utility>
+#include "DepthFirstSearch.h"
 
 class GraphAdjList {
 private:
     int V;
     std::vector<std::list<int>> adjList;
 
-    void dfsUtil(int v, std::vector<bool>& visited) const {
-        visited[v] = true;
-        std::cout << v << " ";
-
-        for (int neighbor : adjList[v]) {
-            if (!visited[neighbor]) {
-                dfsUtil(neighbor, visited);
-            }
-        }
-    }
-
 public:
     // Constructor
     GraphAdjList(int vertices) : V(vertices) {
         adjList.resize(V);
     }
 
+    int numVertices() const { return V; }
+
+    // Neighbours of v in insertion order
+    const std::list<int>& neighbors(int v) const { return adjList[v]; }
+
     // Add edge
     void addEdge(int src, int dest, bool directed = false) {
         if (src >= 0 && src < V && dest >= 0 && dest < V) {
@@ -92,15 +88,35 @@ public:
         std::cout << std::endl;
     }
 
-    // DFS
-    void dfs(int start) const {
-        if (start < 0 || start >= V) return;
+    // DFS (DepthFirstSearch engine; same order as the recursive version)
+    void dfs(int start) const;
 
-        std::vector<bool> visited(V, false);
-        std::cout << "DFS starting from " << start << ": ";
-        dfsUtil(start, visited);
-        std::cout << std::endl;
-    }
+    // DFS preorder from start into order (cleared first; no I/O)
+    void dfsOrder(int start, std::vector<int>& order) const;
+};
+
+// DepthFirstSearch walks each row with a list iterator
+inline int dfsNumVertices(const GraphAdjList &g) { return g.numVertices(); }
+
+template<>
+struct DfsCursor<GraphAdjList> {
+    std::list<int>::const_iterator it;
+    DfsCursor(const GraphAdjList &g, int v) : it(g.neighbors(v).begin()) {}
+    int next(const GraphAdjList &g, int v) { return it == g.neighbors(v).end() ? -1 : *it++; }
 };
 
+inline void GraphAdjList::dfs(int start) const {
+    if (start < 0 || start >= V) return;
+
+    std::vector<int> order;
+    dfsOrder(start, order);
+    std::cout << "DFS starting from " << start << ": ";
+    for (int v : order) std::cout << v << " ";
+    std::cout << std::endl;
+}
+
+inline void GraphAdjList::dfsOrder(int start, std::vector<int>& order) const {
+    dfsPreorder(*this, start, order);
+}
+
 #endif // GRAPH_ADJ_LIST_H
@@ -4,28 +4,21 @@
 #include <iostream>
 #include <vector>
 #include <queue>
+#include <utility>
+#include "DepthFirstSearch.h"
 
 class GraphAdjMatrix {
 private:
     int V;
     std::vector<std::vector<int>> matrix;
-
-    void dfsUtil(int v, std::vector<bool>& visited) const {
-        visited[v] = true;
-        std::cout << v << " ";
-
-        for (int i = 0; i < V; i++) {
-            if (matrix[v][i] != 0 && !visited[i]) {
-                dfsUtil(i, visited);
-            }
-        }
-    }
     
 public:
     // Constructor
     GraphAdjMatrix(int vertices) : V(vertices) {
         matrix.resize(V, std::vector<int>(V, 0));
     }
+
+    int numVertices() const { return V; }
     
     // Add edge (default weight = 1)
     void addEdge(int src, int dest, int weight = 1, bool directed = false) {
@@ -85,16 +78,41 @@ public:
         std::cout << std::endl;
     }
 
-    void dfs(int start) const {
-        if (start < 0 || start >= V) return;
+    // DFS (DepthFirstSearch engine; same order as the recursive version)
+    void dfs(int start) const;
 
-        std::vector<bool> visited(V, false);
-        std::cout << "DFS starting from " << start << ": ";
-        dfsUtil(start, visited);
-        std::cout << std::endl;
+    // DFS preorder from start into order (cleared first; no I/O)
+    void dfsOrder(int start, std::vector<int>& order) const;
+};
+
+// DepthFirstSearch scans each row for nonzero columns, in ascending order
+inline int dfsNumVertices(const GraphAdjMatrix &g) { return g.numVertices(); }
+
+template<>
+struct DfsCursor<GraphAdjMatrix> {
+    int col = 0;
+    DfsCursor(const GraphAdjMatrix &, int) {}
+    int next(const GraphAdjMatrix &g, int v) {
+        while (col < g.numVertices())
+            if (g.hasEdge(v, col++)) return col - 1;
+        return -1;
     }
 };
 
+inline void GraphAdjMatrix::dfs(int start) const {
+    if (start < 0 || start >= V) return;
+
+    std::vector<int> order;
+    dfsOrder(start, order);
+    std::cout << "DFS starting from " << start << ": ";
+    for (int v : order) std::cout << v << " ";
+    std::cout << std::endl;
+}
+
+inline void GraphAdjMatrix::dfsOrder(int start, std::vector<int>& order) const {
+    dfsPreorder(*this, start, order);
+}
+
 
 
 #endif // GRAPH_ADJ_MATRIX_H
@@ -0,0 +1,297 @@
+#ifndef GRAPH_BIT_MATRIX_H
+#define GRAPH_BIT_MATRIX_H
+
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+#include "DepthFirstSearch.h"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Unweighted adjacency matrix packed one bit per entry (32x smaller than GraphAdjMatrix).
+// All rows live in one allocation; every row starts on a 64-byte boundary and is padded
+// to a whole number of 64-byte lines, so rows can be processed in full SIMD vectors.
+// Neighbours are enumerated a word at a time with count-trailing-zeros, and BFS finds
+// the unvisited neighbours of u with one AND-NOT of u's row against the visited mask
+// (AVX2 when compiled with -mavx2, plain 64-bit words otherwise). DFS runs on the
+// DepthFirstSearch engine, stepping through a row with nextNeighbor().
+// Traversal order matches GraphAdjMatrix (neighbours in ascending order).
+class GraphBitMatrix {
+private:
+    static constexpr std::size_t ALIGN = 64;                       // bytes
+    static constexpr std::size_t WORDS_PER_LINE = ALIGN / sizeof(std::uint64_t);
+
+    struct AlignedDelete {
+        void operator()(std::uint64_t *p) const { ::operator delete[](p, std::align_val_t(ALIGN)); }
+    };
+    using Words = std::unique_ptr<std::uint64_t[], AlignedDelete>;
+
+    int V;
+    std::size_t stride;   // words per row (multiple of WORDS_PER_LINE)
+    Words bits;
+
+    static Words allocWords(std::size_t n) {
+        std::uint64_t *p = static_cast<std::uint64_t*>(::operator new[](n * sizeof(std::uint64_t), std::align_val_t(ALIGN)));
+        std::memset(p, 0, n * sizeof(std::uint64_t));
+        return Words(p);
+    }
+
+    static int ctz64(std::uint64_t x) {
+#if defined(_MSC_VER)
+        unsigned long i;
+        _BitScanForward64(&i, x);
+        return static_cast<int>(i);
+#else
+        return __builtin_ctzll(x);
+#endif
+    }
+
+    static int popcount64(std::uint64_t x) {
+#if defined(_MSC_VER)
+        return static_cast<int>(__popcnt64(x));
+#else
+        return __builtin_popcountll(x);
+#endif
+    }
+
+    std::uint64_t* row(int v) { return bits.get() + static_cast<std::size_t>(v) * stride; }
+    const std::uint64_t* row(int v) const { return bits.get() + static_cast<std::size_t>(v) * stride; }
+
+    // fresh = r & ~visited; visited |= r  (returns whether anything was new)
+    static bool expand(const std::uint64_t *r, std::uint64_t *visited, std::uint64_t *fresh, std::size_t words) {
+#if defined(__AVX2__)
+        __m256i any = _mm256_setzero_si256();
+        for (std::size_t w = 0; w < words; w += 4) {
+            __m256i rv = _mm256_load_si256(reinterpret_cast<const __m256i*>(r + w));
+            __m256i vv = _mm256_load_si256(reinterpret_cast<const __m256i*>(visited + w));
+            __m256i nv = _mm256_andnot_si256(vv, rv);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(fresh + w), nv);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(visited + w), _mm256_or_si256(vv, rv));
+            any = _mm256_or_si256(any, nv);
+        }
+        return !_mm256_testz_si256(any, any);
+#else
+        std::uint64_t any = 0;
+        for (std::size_t w = 0; w < words; w++) {
+            std::uint64_t nv = r[w] & ~visited[w];
+            fresh[w] = nv;
+            visited[w] |= r[w];
+            any |= nv;
+        }
+        return any != 0;
+#endif
+    }
+
+    // Call f(v) for every set bit of mask, in ascending order
+    template<typename F>
+    static void forEachBit(const std::uint64_t *mask, std::size_t words, F &&f) {
+        for (std::size_t w = 0; w < words; w++) {
+            std::uint64_t x = mask[w];
+            while (x) {
+                f(static_cast<int>(w * 64) + ctz64(x));
+                x &= x - 1;
+            }
+        }
+    }
+
+    // BFS over bit masks; calls visit(u) in queue order, marks everything reached in visited
+    template<typename Visit>
+    void bfsFrom(int start, std::uint64_t *visited, std::uint64_t *fresh, Visit &&visit) const {
+        std::vector<int> order;
+        order.push_back(start);
+        visited[start >> 6] |= std::uint64_t(1) << (start & 63);
+        for (std::size_t h = 0; h < order.size(); h++) {
+            int u = order[h];
+            visit(u);
+            if (expand(row(u), visited, fresh, stride))
+                forEachBit(fresh, stride, [&order](int v) { order.push_back(v); });
+        }
+    }
+
+public:
+    // Constructor
+    GraphBitMatrix(int vertices)
+        : V(vertices),
+          stride(((static_cast<std::size_t>(vertices) + 63) / 64 + WORDS_PER_LINE - 1) / WORDS_PER_LINE * WORDS_PER_LINE),
+          bits(allocWords(static_cast<std::size_t>(vertices) * stride + (vertices ? 0 : 1))) {}
+
+    // From a 0/1 (or weight) adjacency matrix: nonzero entries become edges
+    explicit GraphBitMatrix(const std::vector<std::vector<int>> &matrix)
+        : GraphBitMatrix(static_cast<int>(matrix.size())) {
+        for (int i = 0; i < V; i++)
+            for (int j = 0; j < V && j < static_cast<int>(matrix[i].size()); j++)
+                if (matrix[i][j] != 0) row(i)[j >> 6] |= std::uint64_t(1) << (j & 63);
+    }
+
+    // non-copyable (one big allocation); moveable
+    GraphBitMatrix(const GraphBitMatrix&) = delete;
+    GraphBitMatrix& operator=(const GraphBitMatrix&) = delete;
+    GraphBitMatrix(GraphBitMatrix &&other) noexcept
+        : V(other.V), stride(other.stride), bits(std::move(other.bits)) {
+        other.V = 0;
+        other.stride = 0;
+    }
+    GraphBitMatrix& operator=(GraphBitMatrix &&other) noexcept {
+        if (this != &other) {
+            V = other.V; stride = other.stride; bits = std::move(other.bits);
+            other.V = 0;
+            other.stride = 0;
+        }
+        return *this;
+    }
+
+    int numVertices() const { return V; }
+    std::size_t wordsPerRow() const { return stride; }
+
+    // Add edge
+    void addEdge(int src, int dest, bool directed = false) {
+        if (src >= 0 && src < V && dest >= 0 && dest < V) {
+            row(src)[dest >> 6] |= std::uint64_t(1) << (dest & 63);
+            if (!directed) row(dest)[src >> 6] |= std::uint64_t(1) << (src & 63);
+        }
+    }
+
+    // Remove edge
+    void removeEdge(int src, int dest, bool directed = false) {
+        if (src >= 0 && src < V && dest >= 0 && dest < V) {
+            row(src)[dest >> 6] &= ~(std::uint64_t(1) << (dest & 63));
+            if (!directed) row(dest)[src >> 6] &= ~(std::uint64_t(1) << (src & 63));
+        }
+    }
+
+    // Check if edge exists
+    bool hasEdge(int src, int dest) const {
+        return src >= 0 && src < V && dest >= 0 && dest < V &&
+               ((row(src)[dest >> 6] >> (dest & 63)) & 1u);
+    }
+
+    // Out-degree (popcount of the row)
+    int degree(int v) const {
+        int d = 0;
+        const std::uint64_t *r = row(v);
+        for (std::size_t w = 0; w < stride; w++) d += popcount64(r[w]);
+        return d;
+    }
+
+    // Visit v's neighbours in ascending order
+    template<typename F>
+    void forEachNeighbor(int v, F &&f) const { forEachBit(row(v), stride, std::forward<F>(f)); }
+
+    // First neighbour of v at column >= from (-1 if none)
+    int nextNeighbor(int v, int from) const {
+        const std::uint64_t *r = row(v);
+        std::size_t w = static_cast<std::size_t>(from) >> 6;
+        if (w >= stride) return -1;
+        std::uint64_t x = r[w] & (~std::uint64_t(0) << (from & 63));
+        while (!x) {
+            if (++w == stride) return -1;
+            x = r[w];
+        }
+        return static_cast<int>(w * 64) + ctz64(x);
+    }
+
+    std::vector<int> neighbors(int v) const {
+        std::vector<int> out;
+        forEachNeighbor(v, [&out](int u) { out.push_back(u); });
+        return out;
+    }
+
+    // Raw 64-byte-aligned row (wordsPerRow() words)
+    const std::uint64_t* rowBits(int v) const { return row(v); }
+
+    // Print adjacency matrix
+    void printGraph() const {
+        std::cout << "Adjacency Matrix:\n";
+        for (int i = 0; i < V; i++) {
+            for (int j = 0; j < V; j++) {
+                std::cout << (hasEdge(i, j) ? 1 : 0) << " ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    // BFS distances and parents (-1 = unreachable / root), as qalg::bfs_on_adjlist on
+    // the ascending adjacency lists of this matrix
+    std::pair<std::vector<int>, std::vector<int>> bfsTree(int start) const {
+        std::vector<int> dist(V, -1), parent(V, -1);
+        if (start < 0 || start >= V) return {dist, parent};
+        Words visited = allocWords(stride), fresh = allocWords(stride);
+        dist[start] = 0;
+        std::vector<int> order{start};
+        visited[start >> 6] |= std::uint64_t(1) << (start & 63);
+        for (std::size_t h = 0; h < order.size(); h++) {
+            int u = order[h];
+            if (!expand(row(u), visited.get(), fresh.get(), stride)) continue;
+            forEachBit(fresh.get(), stride, [&](int v) {
+                dist[v] = dist[u] + 1;
+                parent[v] = u;
+                order.push_back(v);
+            });
+        }
+        return {dist, parent};
+    }
+
+    void bfs(int start) const {
+        if (start < 0 || start >= V) return;
+
+        Words visited = allocWords(stride), fresh = allocWords(stride);
+        std::cout << "BFS starting from " << start << ": ";
+        bfsFrom(start, visited.get(), fresh.get(), [](int u) { std::cout << u << " "; });
+        std::cout << std::endl;
+    }
+
+    // DFS (DepthFirstSearch engine; same order as the recursive version)
+    void dfs(int start) const;
+
+    // Number of connected components (undirected graphs), e.g. "number of provinces"
+    int countComponents() const {
+        Words visited = allocWords(stride), fresh = allocWords(stride);
+        int count = 0;
+        for (std::size_t w = 0; w < stride; w++) {
+            // every vertex below this word is already visited; take the next unvisited one
+            for (;;) {
+                std::uint64_t x = ~visited[w];
+                int v = static_cast<int>(w * 64) + (x ? ctz64(x) : 64);
+                if (!x || v >= V) break;
+                bfsFrom(v, visited.get(), fresh.get(), [](int) {});
+                count++;
+            }
+        }
+        return count;
+    }
+};
+
+// DepthFirstSearch walks each row bit by bit, in ascending column order
+inline int dfsNumVertices(const GraphBitMatrix &g) { return g.numVertices(); }
+
+template<>
+struct DfsCursor<GraphBitMatrix> {
+    int col = 0;
+    DfsCursor(const GraphBitMatrix &, int) {}
+    int next(const GraphBitMatrix &g, int v) {
+        int w = g.nextNeighbor(v, col);
+        if (w >= 0) col = w + 1;
+        return w;
+    }
+};
+
+inline void GraphBitMatrix::dfs(int start) const {
+    if (start < 0 || start >= V) return;
+
+    std::vector<int> order;
+    dfsPreorder(*this, start, order);
+    std::cout << "DFS starting from " << start << ": ";
+    for (int v : order) std::cout << v << " ";
+    std::cout << std::endl;
+}
+
+#endif // GRAPH_BIT_MATRIX_H
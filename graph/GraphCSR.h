@@ -0,0 +1,265 @@
+#ifndef GRAPH_CSR_H
+#define GRAPH_CSR_H
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include "GraphAdjList.h"
+#include "DepthFirstSearch.h"
+
+// Immutable compressed-sparse-row graph.
+// The neighbours of v are targets[offsets[v] .. offsets[v + 1]), so a traversal reads
+// two flat arrays front to back instead of chasing one list node per edge like
+// GraphAdjList. Optional weights sit in a parallel array (default weight = 1).
+// Build it once from an edge list or a GraphAdjList; neighbour order is preserved.
+class GraphCSR {
+public:
+    struct Edge {
+        int src;
+        int dest;
+        int weight;
+    };
+
+    // Contiguous view of one row (range-for friendly)
+    template<typename T>
+    struct Span {
+        const T *first;
+        const T *last;
+        const T* begin() const { return first; }
+        const T* end() const { return last; }
+        std::size_t size() const { return static_cast<std::size_t>(last - first); }
+        bool empty() const { return first == last; }
+        const T& operator[](std::size_t i) const { return first[i]; }
+    };
+
+private:
+    int V;
+    std::vector<std::size_t> offsets;   // V + 1 entries
+    std::vector<int> targets;           // one entry per stored (directed) edge
+    std::vector<int> weights;           // empty when unweighted
+    bool sortedRows;
+
+    // Counting sort of the edges by source: two linear passes, stable per source.
+    void build(const std::vector<Edge> &edges, bool directed, bool weighted) {
+        offsets.assign(V + 1, 0);
+        for (const Edge &e : edges) {
+            if (e.src < 0 || e.src >= V || e.dest < 0 || e.dest >= V) continue;
+            ++offsets[e.src + 1];
+            if (!directed) ++offsets[e.dest + 1];
+        }
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        targets.resize(offsets[V]);
+        if (weighted) weights.resize(offsets[V]);
+        std::vector<std::size_t> pos(offsets.begin(), offsets.end() - 1);
+        for (const Edge &e : edges) {
+            if (e.src < 0 || e.src >= V || e.dest < 0 || e.dest >= V) continue;
+            std::size_t i = pos[e.src]++;
+            targets[i] = e.dest;
+            if (weighted) weights[i] = e.weight;
+            if (!directed) {
+                std::size_t j = pos[e.dest]++;
+                targets[j] = e.src;
+                if (weighted) weights[j] = e.weight;
+            }
+        }
+    }
+
+public:
+    // From an edge list (weights used only if weighted == true)
+    GraphCSR(int vertices, const std::vector<Edge> &edges, bool directed = false, bool weighted = false)
+        : V(vertices), sortedRows(false) {
+        build(edges, directed, weighted);
+    }
+
+    // From unweighted (src, dest) pairs
+    GraphCSR(int vertices, const std::vector<std::pair<int, int>> &edges, bool directed = false)
+        : V(vertices), sortedRows(false) {
+        std::vector<Edge> es;
+        es.reserve(edges.size());
+        for (const auto &p : edges) es.push_back({p.first, p.second, 1});
+        build(es, directed, false);
+    }
+
+    // Snapshot of a GraphAdjList (same neighbour order)
+    explicit GraphCSR(const GraphAdjList &g) : V(g.numVertices()), sortedRows(false) {
+        offsets.assign(V + 1, 0);
+        for (int v = 0; v < V; v++) offsets[v + 1] = offsets[v] + g.neighbors(v).size();
+        targets.reserve(offsets[V]);
+        for (int v = 0; v < V; v++)
+            for (int u : g.neighbors(v)) targets.push_back(u);
+    }
+
+    // From adjacency vectors (adj[v] = out-neighbours of v, order preserved).
+    // Targets outside [0, adj.size()) are dropped, like out-of-range edges in build().
+    explicit GraphCSR(const std::vector<std::vector<int>> &adj)
+        : V(static_cast<int>(adj.size())), sortedRows(false) {
+        offsets.assign(V + 1, 0);
+        for (int v = 0; v < V; v++) {
+            std::size_t d = 0;
+            for (int u : adj[v]) if (u >= 0 && u < V) ++d;
+            offsets[v + 1] = offsets[v] + d;
+        }
+        targets.reserve(offsets[V]);
+        for (int v = 0; v < V; v++)
+            for (int u : adj[v])
+                if (u >= 0 && u < V) targets.push_back(u);
+    }
+
+    // Reverse every edge (in-neighbour rows); rows list sources in ascending order
+    GraphCSR transposed() const {
+        std::vector<Edge> es;
+        es.reserve(targets.size());
+        for (int v = 0; v < V; v++)
+            for (std::size_t e = offsets[v]; e < offsets[v + 1]; e++)
+                es.push_back({targets[e], v, weights.empty() ? 1 : weights[e]});
+        return GraphCSR(V, es, true, !weights.empty());
+    }
+
+    int numVertices() const { return V; }
+    std::size_t numEdges() const { return targets.size(); }   // stored (directed) edges
+    bool isWeighted() const { return !weights.empty(); }
+
+    std::size_t degree(int v) const { return offsets[v + 1] - offsets[v]; }
+
+    Span<int> neighbors(int v) const {
+        return {targets.data() + offsets[v], targets.data() + offsets[v + 1]};
+    }
+
+    // Weights of v's edges, parallel to neighbors(v) (empty span if unweighted)
+    Span<int> edgeWeights(int v) const {
+        if (weights.empty()) return {nullptr, nullptr};
+        return {weights.data() + offsets[v], weights.data() + offsets[v + 1]};
+    }
+
+    // Raw arrays (for algorithms that want to index them directly)
+    const std::vector<std::size_t>& rowOffsets() const { return offsets; }
+    const std::vector<int>& columnTargets() const { return targets; }
+
+    // Sort every row by target id; afterwards hasEdge/edgeWeight use binary search.
+    // Changes traversal order to ascending neighbour id.
+    void sortNeighbors() {
+        std::vector<std::pair<int, int>> row;
+        for (int v = 0; v < V; v++) {
+            std::size_t b = offsets[v], e = offsets[v + 1];
+            row.clear();
+            for (std::size_t i = b; i < e; i++) row.push_back({targets[i], weights.empty() ? 0 : weights[i]});
+            std::stable_sort(row.begin(), row.end(),
+                             [](const std::pair<int, int> &x, const std::pair<int, int> &y) { return x.first < y.first; });
+            for (std::size_t i = b; i < e; i++) {
+                targets[i] = row[i - b].first;
+                if (!weights.empty()) weights[i] = row[i - b].second;
+            }
+        }
+        sortedRows = true;
+    }
+
+    // Check if edge exists: O(log degree) once sorted, O(degree) otherwise
+    bool hasEdge(int src, int dest) const {
+        return edgeIndex(src, dest) != offsets.back();
+    }
+
+    // Weight of src -> dest (1 for unweighted graphs, 0 if there is no such edge)
+    int edgeWeight(int src, int dest) const {
+        std::size_t i = edgeIndex(src, dest);
+        if (i == offsets.back()) return 0;
+        return weights.empty() ? 1 : weights[i];
+    }
+
+    // Position of src -> dest in targets (numEdges() if absent)
+    std::size_t edgeIndex(int src, int dest) const {
+        if (src < 0 || src >= V || dest < 0 || dest >= V) return offsets.back();
+        const int *b = targets.data() + offsets[src];
+        const int *e = targets.data() + offsets[src + 1];
+        const int *it = sortedRows ? std::lower_bound(b, e, dest) : std::find(b, e, dest);
+        return (it != e && *it == dest) ? static_cast<std::size_t>(it - targets.data()) : offsets.back();
+    }
+
+    // Print adjacency rows
+    void printGraph() const {
+        std::cout << "CSR Adjacency:\n";
+        for (int i = 0; i < V; i++) {
+            std::cout << i << ": ";
+            for (std::size_t e = offsets[i]; e < offsets[i + 1]; e++) {
+                std::cout << targets[e];
+                if (!weights.empty()) std::cout << "(" << weights[e] << ")";
+                std::cout << " ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    // BFS distances and BFS-tree parents from start (-1 = unreachable / root),
+    // same contract as qalg::bfs_on_adjlist
+    std::pair<std::vector<int>, std::vector<int>> bfsTree(int start) const {
+        std::vector<int> dist(V, -1), parent(V, -1);
+        if (start < 0 || start >= V) return {dist, parent};
+        // the frontier is a plain array: vertices are appended and read in order
+        std::vector<int> order;
+        order.reserve(V);
+        dist[start] = 0;
+        order.push_back(start);
+        for (std::size_t h = 0; h < order.size(); h++) {
+            int u = order[h];
+            for (std::size_t e = offsets[u]; e < offsets[u + 1]; e++) {
+                int w = targets[e];
+                if (dist[w] == -1) {
+                    dist[w] = dist[u] + 1;
+                    parent[w] = u;
+                    order.push_back(w);
+                }
+            }
+        }
+        return {dist, parent};
+    }
+
+    // BFS
+    void bfs(int start) const {
+        if (start < 0 || start >= V) return;
+
+        std::vector<bool> visited(V, false);
+        std::vector<int> order;
+        order.reserve(V);
+
+        visited[start] = true;
+        order.push_back(start);
+
+        std::cout << "BFS starting from " << start << ": ";
+
+        for (std::size_t h = 0; h < order.size(); h++) {
+            int u = order[h];
+            std::cout << u << " ";
+            for (std::size_t e = offsets[u]; e < offsets[u + 1]; e++) {
+                int w = targets[e];
+                if (!visited[w]) {
+                    visited[w] = true;
+                    order.push_back(w);
+                }
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // DFS (DepthFirstSearch engine; same order as the recursive version)
+    void dfs(int start) const;
+};
+
+// DepthFirstSearch indexes the rows directly (default DfsCursor)
+inline int dfsNumVertices(const GraphCSR &g) { return g.numVertices(); }
+inline std::size_t dfsDegree(const GraphCSR &g, int v) { return g.degree(v); }
+inline int dfsNeighbor(const GraphCSR &g, int v, std::size_t i) { return g.neighbors(v)[i]; }
+
+inline void GraphCSR::dfs(int start) const {
+    if (start < 0 || start >= V) return;
+
+    std::vector<int> order;
+    dfsPreorder(*this, start, order);
+    std::cout << "DFS starting from " << start << ": ";
+    for (int v : order) std::cout << v << " ";
+    std::cout << std::endl;
+}
+
+#endif // GRAPH_CSR_H
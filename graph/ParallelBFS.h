@@ -0,0 +1,314 @@
+#ifndef PARALLEL_BFS_H
+#define PARALLEL_BFS_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "GraphCSR.h"
+#include "../queue/work_stealing_pool.h"
+
+// Multi-threaded direction-optimizing BFS (Beamer, Asanović & Patterson) on a GraphCSR.
+//
+// Each level is expanded either
+//   top-down:  every frontier vertex claims its unvisited neighbours (CAS on dist);
+//              the frontier is a vertex array
+//   bottom-up: every unvisited vertex scans its in-neighbours and stops at the first one
+//              in the frontier; the frontier is a bitmap, and each task owns whole
+//              bitmap words (64 vertices each), so the next frontier is written without atomics
+// and switches with Beamer's heuristic: go bottom-up once the frontier's edges exceed
+// 1/alpha of the unexplored edges, come back when the frontier drops below n/beta vertices.
+// Big middle levels of low-diameter graphs then cost far fewer edge checks.
+//
+// run(start) returns (dist, parent) exactly like qalg::bfs_on_adjlist on the same
+// adjacency order: dist is level-synchronous anyway, and the parents the queue-based BFS
+// would pick (the earliest-dequeued neighbour on the previous level) are reconstructed in
+// a parallel level-by-level pass. Pass canonicalParents = false to skip that pass and
+// accept any valid BFS parent.
+//
+// Bottom-up steps need in-neighbours: for an undirected (symmetric) graph the graph itself
+// serves; for a directed graph pass its transposed() copy.
+class ParallelBFS {
+private:
+    const GraphCSR &g;
+    const GraphCSR &in;          // in-neighbour rows (== g when symmetric)
+    WorkStealingPool &pool;
+    int V;
+    std::size_t nwords;
+
+    std::unique_ptr<std::atomic<int>[]> dist;
+    std::vector<int> parent;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> curBits;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> nextBits;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> key;   // canonical pass: (slot of parent, edge pos)
+
+    // Per-chunk output. Each level is cut into at most local.size() chunks and chunk k
+    // writes only local[k]; a chunk runs exactly once, on whichever thread picks it up
+    // (a caller waiting in parallel_for may run anyone's tasks), so buffers are never shared.
+    struct alignas(64) Local {
+        std::vector<int> next;
+        std::size_t edges = 0;
+        std::size_t count = 0;
+    };
+    std::vector<Local> local;
+
+    double alpha = 14.0;
+    double beta = 24.0;
+    int topDownSteps = 0;
+    int bottomUpSteps = 0;
+
+    // f(local[k], begin, end) for consecutive chunks [begin, end) of [0, n)
+    template<typename F>
+    void forChunks(std::size_t n, F &&f) {
+        std::size_t chunks = std::min(n, local.size());
+        pool.parallel_for(0, chunks, [&](std::size_t k) {
+            f(local[k], n * k / chunks, n * (k + 1) / chunks);
+        }, 1);
+    }
+
+    void resetLocals() {
+        for (Local &l : local) {
+            l.next.clear();
+            l.edges = 0;
+            l.count = 0;
+        }
+    }
+
+    // Frontier array -> next frontier array; returns edges out of the new frontier
+    std::size_t topDownStep(std::vector<int> &frontier, int depth) {
+        const std::vector<std::size_t> &off = g.rowOffsets();
+        const std::vector<int> &tgt = g.columnTargets();
+        resetLocals();
+        forChunks(frontier.size(), [&](Local &l, std::size_t b, std::size_t end) {
+            for (std::size_t i = b; i < end; i++) {
+                int u = frontier[i];
+                for (std::size_t e = off[u]; e < off[u + 1]; e++) {
+                    int w = tgt[e];
+                    if (dist[w].load(std::memory_order_relaxed) != -1) continue;
+                    int expected = -1;
+                    if (dist[w].compare_exchange_strong(expected, depth + 1, std::memory_order_relaxed)) {
+                        parent[w] = u;
+                        l.next.push_back(w);
+                        l.edges += off[w + 1] - off[w];
+                    }
+                }
+            }
+        });
+        frontier.clear();
+        std::size_t edges = 0;
+        for (Local &l : local) {
+            frontier.insert(frontier.end(), l.next.begin(), l.next.end());
+            edges += l.edges;
+        }
+        return edges;
+    }
+
+    // curBits -> nextBits; returns (vertices, edges) of the new frontier
+    std::pair<std::size_t, std::size_t> bottomUpStep(int depth) {
+        const std::vector<std::size_t> &off = g.rowOffsets();
+        const std::vector<std::size_t> &inOff = in.rowOffsets();
+        const std::vector<int> &inTgt = in.columnTargets();
+        resetLocals();
+        forChunks(nwords, [&](Local &l, std::size_t b, std::size_t end) {
+            for (std::size_t k = b; k < end; k++) {
+                std::uint64_t bits = 0;
+                int lo = static_cast<int>(k * 64);
+                int hi = std::min(V, lo + 64);
+                for (int w = lo; w < hi; w++) {
+                    if (dist[w].load(std::memory_order_relaxed) != -1) continue;
+                    for (std::size_t e = inOff[w]; e < inOff[w + 1]; e++) {
+                        int u = inTgt[e];
+                        if ((curBits[u >> 6].load(std::memory_order_relaxed) >> (u & 63)) & 1u) {
+                            dist[w].store(depth + 1, std::memory_order_relaxed);
+                            parent[w] = u;
+                            bits |= std::uint64_t(1) << (w & 63);
+                            l.count++;
+                            l.edges += off[w + 1] - off[w];
+                            break;
+                        }
+                    }
+                }
+                nextBits[k].store(bits, std::memory_order_relaxed);
+            }
+        });
+        std::swap(curBits, nextBits);
+        std::size_t count = 0, edges = 0;
+        for (Local &l : local) {
+            count += l.count;
+            edges += l.edges;
+        }
+        return {count, edges};
+    }
+
+    void arrayToBitmap(const std::vector<int> &frontier) {
+        for (std::size_t k = 0; k < nwords; k++) curBits[k].store(0, std::memory_order_relaxed);
+        pool.parallel_for(0, frontier.size(), [&](std::size_t i) {
+            int u = frontier[i];
+            curBits[u >> 6].fetch_or(std::uint64_t(1) << (u & 63), std::memory_order_relaxed);
+        });
+    }
+
+    void bitmapToArray(std::vector<int> &frontier) const {
+        frontier.clear();
+        for (std::size_t k = 0; k < nwords; k++) {
+            std::uint64_t bits = curBits[k].load(std::memory_order_relaxed);
+            while (bits) {
+                int b = __builtin_ctzll(bits);
+                frontier.push_back(static_cast<int>(k * 64) + b);
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    // Rebuild the parents the sequential queue BFS would choose. Level d+1 is ordered by
+    // (position of its parent in level d, position of the vertex in that parent's row);
+    // the parent is the earliest level-d vertex that has it as a neighbour.
+    void canonicalizeParents(int start, int maxDepth) {
+        const std::vector<std::size_t> &off = g.rowOffsets();
+        const std::vector<int> &tgt = g.columnTargets();
+
+        // bucket vertices by level (order inside a bucket is fixed below)
+        std::vector<std::size_t> levelStart(maxDepth + 2, 0);
+        for (int v = 0; v < V; v++) {
+            int d = dist[v].load(std::memory_order_relaxed);
+            if (d >= 0) levelStart[d + 1]++;
+        }
+        for (int d = 0; d <= maxDepth; d++) levelStart[d + 1] += levelStart[d];
+        std::vector<int> order(levelStart[maxDepth + 1]);
+        {
+            std::vector<std::size_t> fill(levelStart.begin(), levelStart.end() - 1);
+            for (int v = 0; v < V; v++) {
+                int d = dist[v].load(std::memory_order_relaxed);
+                if (d >= 0) order[fill[d]++] = v;
+            }
+        }
+        order[0] = start;
+        parent[start] = -1;
+
+        std::vector<std::size_t> groupStart;
+        std::vector<int> sorted;
+        for (int d = 0; d < maxDepth; d++) {
+            const int *level = order.data() + levelStart[d];
+            std::size_t levelSize = levelStart[d + 1] - levelStart[d];
+            int *next = order.data() + levelStart[d + 1];
+            std::size_t nextSize = levelStart[d + 2] - levelStart[d + 1];
+
+            for (std::size_t i = 0; i < nextSize; i++) key[next[i]].store(UINT64_MAX, std::memory_order_relaxed);
+            pool.parallel_for(0, levelSize, [&](std::size_t i) {
+                int u = level[i];
+                for (std::size_t e = off[u]; e < off[u + 1]; e++) {
+                    int w = tgt[e];
+                    if (dist[w].load(std::memory_order_relaxed) != d + 1) continue;
+                    std::uint64_t k = (std::uint64_t(i) << 32) | std::uint64_t(e - off[u]);
+                    std::uint64_t cur = key[w].load(std::memory_order_relaxed);
+                    while (k < cur && !key[w].compare_exchange_weak(cur, k, std::memory_order_relaxed)) {}
+                }
+            });
+
+            // counting sort by parent slot, then by edge position inside each group
+            groupStart.assign(levelSize + 1, 0);
+            for (std::size_t i = 0; i < nextSize; i++)
+                groupStart[(key[next[i]].load(std::memory_order_relaxed) >> 32) + 1]++;
+            for (std::size_t i = 0; i < levelSize; i++) groupStart[i + 1] += groupStart[i];
+            sorted.resize(nextSize);
+            {
+                std::vector<std::size_t> fill(groupStart.begin(), groupStart.end() - 1);
+                for (std::size_t i = 0; i < nextSize; i++) {
+                    int w = next[i];
+                    sorted[fill[key[w].load(std::memory_order_relaxed) >> 32]++] = w;
+                }
+            }
+            for (std::size_t p = 0; p < levelSize; p++) {
+                if (groupStart[p + 1] - groupStart[p] < 2) continue;
+                std::sort(sorted.begin() + groupStart[p], sorted.begin() + groupStart[p + 1], [this](int a, int b) {
+                    return key[a].load(std::memory_order_relaxed) < key[b].load(std::memory_order_relaxed);
+                });
+            }
+            for (std::size_t i = 0; i < nextSize; i++) {
+                int w = sorted[i];
+                next[i] = w;
+                parent[w] = level[key[w].load(std::memory_order_relaxed) >> 32];
+            }
+        }
+    }
+
+public:
+    // inEdges: in-neighbour rows for a directed graph (g.transposed()); nullptr = symmetric
+    ParallelBFS(const GraphCSR &graph, WorkStealingPool &workers, const GraphCSR *inEdges = nullptr)
+        : g(graph), in(inEdges ? *inEdges : graph), pool(workers), V(graph.numVertices()),
+          nwords((static_cast<std::size_t>(graph.numVertices()) + 63) / 64),
+          dist(new std::atomic<int>[graph.numVertices()]),
+          parent(graph.numVertices(), -1),
+          curBits(new std::atomic<std::uint64_t>[nwords]),
+          nextBits(new std::atomic<std::uint64_t>[nwords]),
+          local(workers.size() * 8) {}
+
+    // Switching thresholds (Beamer's defaults: alpha = 14, beta = 24)
+    void setThresholds(double a, double b) {
+        alpha = a;
+        beta = b;
+    }
+
+    // Levels expanded each way during the last run()
+    int lastTopDownSteps() const { return topDownSteps; }
+    int lastBottomUpSteps() const { return bottomUpSteps; }
+
+    // BFS from start: (dist, parent) with -1 for unreachable vertices and the root's parent
+    std::pair<std::vector<int>, std::vector<int>> run(int start, bool canonicalParents = true) {
+        if (start < 0 || start >= V) throw std::out_of_range("ParallelBFS::run: start node out of range");
+        const std::vector<std::size_t> &off = g.rowOffsets();
+
+        pool.parallel_for(0, static_cast<std::size_t>(V), [&](std::size_t v) {
+            dist[v].store(-1, std::memory_order_relaxed);
+            parent[v] = -1;
+        });
+        topDownSteps = bottomUpSteps = 0;
+
+        dist[start].store(0, std::memory_order_relaxed);
+        std::vector<int> frontier{start};
+        std::size_t frontierSize = 1;
+        std::size_t frontierEdges = off[start + 1] - off[start];
+        std::size_t unexploredEdges = g.numEdges() - frontierEdges;
+        bool bottomUp = false;
+        int depth = 0;
+
+        while (frontierSize > 0) {
+            if (!bottomUp && frontierEdges > unexploredEdges / alpha) {
+                arrayToBitmap(frontier);
+                bottomUp = true;
+            } else if (bottomUp && frontierSize < V / beta) {
+                bitmapToArray(frontier);
+                bottomUp = false;
+            }
+
+            if (bottomUp) {
+                std::pair<std::size_t, std::size_t> r = bottomUpStep(depth);
+                frontierSize = r.first;
+                frontierEdges = r.second;
+                bottomUpSteps++;
+            } else {
+                frontierEdges = topDownStep(frontier, depth);
+                frontierSize = frontier.size();
+                topDownSteps++;
+            }
+            unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+            depth++;
+        }
+        int maxDepth = depth - 1;
+
+        if (canonicalParents) {
+            if (!key) key.reset(new std::atomic<std::uint64_t>[V]);
+            canonicalizeParents(start, maxDepth);
+        }
+
+        std::vector<int> d(V);
+        for (int v = 0; v < V; v++) d[v] = dist[v].load(std::memory_order_relaxed);
+        return {d, parent};
+    }
+};
+
+#endif // PARALLEL_BFS_H
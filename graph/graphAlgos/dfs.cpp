@@ -2,6 +2,7 @@
 #include <vector>
 #include <stack>
 #include <algorithm>
+#include "../DepthFirstSearch.h"
 
 using namespace std;
 
@@ -9,13 +10,11 @@ class Graph {
 private:
     int V;                        // number of vertices
     vector<vector<int>> adj;      // adjacency list
-    vector<int> visited;          // visited array
 
 public:
     Graph(int vertices) {
         V = vertices;
         adj.resize(V);
-        visited.assign(V, 0);
     }
 
     void addEdge(int u, int v, bool isDirected = false) {
@@ -24,21 +23,15 @@ public:
             adj[v].push_back(u);
     }
 
-    // ---------- Recursive DFS ----------
-    void dfsRecursive(int node) {
-        visited[node] = 1;
-        cout << node << " ";
-
-        for (int neighbor : adj[node]) {
-            if (!visited[neighbor])
-                dfsRecursive(neighbor);
-        }
-    }
-
+    // ---------- Recursive-order DFS ----------
+    // Visits vertices in the classic recursive order, but runs on the DFS engine's explicit
+    // stack of (vertex, next edge) frames, so deep graphs can't overflow the call stack.
+    // The order goes into a buffer and is printed afterwards.
     void dfsRecursiveStart(int start) {
-        fill(visited.begin(), visited.end(), 0);
-        cout << "Recursive DFS starting from " << start << ": ";
-        dfsRecursive(start);
+        vector<int> order;
+        dfsPreorder(adj, start, order);
+        cout << "Recursive-order DFS starting from " << start << ": ";
+        for (int node : order) cout << node << " ";
         cout << endl;
     }
 
@@ -70,12 +63,19 @@ public:
 
     // ---------- DFS for Disconnected Graph ----------
     void dfsDisconnected() {
-        fill(visited.begin(), visited.end(), 0);
+        struct Collect : DfsVisitor {
+            vector<int>& out;
+            explicit Collect(vector<int>& o) : out(o) {}
+            void discover(int v) { out.push_back(v); }
+        };
+        vector<int> order;
+        order.reserve(V);
+        Collect vis(order);
+        DepthFirstSearch<vector<vector<int>>> dfs(adj);
+        dfs.runAll(vis);    // every unvisited vertex becomes a new root, in ascending order
+
         cout << "DFS for disconnected graph: ";
-        for (int i = 0; i < V; ++i) {
-            if (!visited[i])
-                dfsRecursive(i);
-        }
+        for (int node : order) cout << node << " ";
         cout << endl;
     }
 
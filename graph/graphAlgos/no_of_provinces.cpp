@@ -1,41 +1,20 @@
 #include <iostream>
 #include <vector>
+#include "../GraphBitMatrix.h"
 using namespace std;
 
 class Graph {
 private:
-    vector<vector<int>> isConnected;  // adjacency matrix
-    vector<int> visited;
-    int n;  // number of cities
-
-    // Depth-First Search helper
-    void dfs(int i) {
-        visited[i] = 1;
-        for (int j = 0; j < n; ++j) {
-            if (isConnected[i][j] == 1 && !visited[j]) {
-                dfs(j);
-            }
-        }
-    }
+    GraphBitMatrix isConnected;  // adjacency matrix, one bit per entry
 
 public:
-    // Constructor
-    Graph(const vector<vector<int>>& matrix) {
-        isConnected = matrix;
-        n = isConnected.size();
-        visited.assign(n, 0);
-    }
+    // Constructor (packs the matrix instead of copying it)
+    Graph(const vector<vector<int>>& matrix) : isConnected(matrix) {}
 
-    // Count number of connected components (provinces)
-    int countProvinces() {
-        int count = 0;
-        for (int i = 0; i < n; ++i) {
-            if (!visited[i]) {
-                dfs(i);
-                count++;
-            }
-        }
-        return count;
+    // Count number of connected components (provinces):
+    // each BFS step marks a whole row of neighbours with one AND-NOT against the visited bits
+    int countProvinces() const {
+        return isConnected.countComponents();
     }
 };
 
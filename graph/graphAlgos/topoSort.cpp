@@ -1,41 +1,18 @@
 #include <iostream>
+#include <stdexcept>
 #include <vector>
-#include <stack>
-#include <algorithm>
+#include "../DepthFirstSearch.h"
 
 class Solution {
-private:
-    // Recursive DFS helper
-    void dfs(int node, const std::vector<std::vector<int>>& adj, 
-             std::vector<bool>& visited, std::stack<int>& st) {
-        visited[node] = true;
-        for (int neighbor : adj[node]) {
-            if (!visited[neighbor]) {
-                dfs(neighbor, adj, visited, st);
-            }
-        }
-        st.push(node); // push after visiting all neighbors
-    }
-
 public:
     // Function to return one possible topological ordering
+    // (reverse DFS postorder, computed on the iterative engine: no recursion depth limit).
+    // adj must have exactly V rows; returns an empty vector if the graph has a cycle.
     std::vector<int> topoSort(int V, const std::vector<std::vector<int>>& adj) {
-        std::vector<bool> visited(V, false);
-        std::stack<int> st;
-
-        for (int i = 0; i < V; ++i) {
-            if (!visited[i]) {
-                dfs(i, adj, visited, st);
-            }
-        }
-
+        if (V < 0 || adj.size() != static_cast<std::size_t>(V))
+            throw std::invalid_argument("topoSort: adj must have exactly V rows");
         std::vector<int> topoOrder;
-        topoOrder.reserve(V);
-        while (!st.empty()) {
-            topoOrder.push_back(st.top());
-            st.pop();
-        }
-
+        if (!topologicalSort(adj, topoOrder)) topoOrder.clear();
         return topoOrder;
     }
 };
@@ -73,5 +50,21 @@ int main() {
         std::cout << node << " ";
     std::cout << "\n";
 
+    // Example 3 (0 -> 1 -> 2 -> 0 is a cycle)
+    V = 3;
+    adj.assign(V, {});
+    adj[0].push_back(1);
+    adj[1].push_back(2);
+    adj[2].push_back(0);
+
+    result = obj.topoSort(V, adj);
+
+    std::cout << "Topological Sort (Example 3): ";
+    if (result.empty())
+        std::cout << "none, the graph has a cycle";
+    for (int node : result)
+        std::cout << node << " ";
+    std::cout << "\n";
+
     return 0;
 }
@@ -0,0 +1,212 @@
+#ifndef CACHE_STATS_H
+#define CACHE_STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+/*
+  cache_stats.h
+  - Statistics policies for LRUCache<Key, Value, Stats> (and ShardedLRUCache)
+      NoCacheStats     — default; every hook is an empty inline function, compiles to nothing,
+                         and (held through CacheStatsHolder) the object takes no space
+      CacheStats       — hit / miss / insert / update / eviction counters
+      TimedCacheStats  — CacheStats + log2 latency histograms for get and put
+  - Counters are std::atomic<uint64_t> written with relaxed load+store (no locked RMW):
+    a cache instance has a single writer at a time (LRUCache is single-threaded, each
+    ShardedLRUCache shard is locked), while snapshot() may run concurrently from any thread.
+    Sharded caches aggregate one Stats object per shard.
+  - CacheStatsSnapshot is a plain struct you can export, add together, or print.
+*/
+
+enum class CacheOp : std::uint8_t { Get = 0, Put = 1 };
+
+struct CacheStatsSnapshot {
+    // latency bucket i counts operations that took [2^i, 2^(i+1)) nanoseconds
+    static constexpr std::size_t LATENCY_BUCKETS = 40;
+
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t inserts = 0;
+    std::uint64_t updates = 0;
+    std::uint64_t evictions = 0;
+    std::uint64_t latency[2][LATENCY_BUCKETS] = {}; // indexed by CacheOp
+
+    double hit_ratio() const {
+        std::uint64_t lookups = hits + misses;
+        return lookups ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+    }
+
+    // Upper bound (ns) of the bucket holding the p-th percentile (p in [0, 1]); 0 if no samples.
+    std::uint64_t latency_percentile(CacheOp op, double p) const {
+        const std::uint64_t *h = latency[static_cast<int>(op)];
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < LATENCY_BUCKETS; ++i) total += h[i];
+        if (total == 0) return 0;
+        std::uint64_t rank = static_cast<std::uint64_t>(p * static_cast<double>(total - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+            seen += h[i];
+            if (seen >= rank) return (std::uint64_t{2} << i) - 1;
+        }
+        return (std::uint64_t{2} << (LATENCY_BUCKETS - 1)) - 1;
+    }
+
+    CacheStatsSnapshot& operator+=(const CacheStatsSnapshot &o) {
+        hits += o.hits;
+        misses += o.misses;
+        inserts += o.inserts;
+        updates += o.updates;
+        evictions += o.evictions;
+        for (int op = 0; op < 2; ++op)
+            for (std::size_t i = 0; i < LATENCY_BUCKETS; ++i) latency[op][i] += o.latency[op][i];
+        return *this;
+    }
+
+    void print(std::ostream &os = std::cout) const {
+        os << "hits=" << hits << " misses=" << misses << " hit_ratio=" << hit_ratio()
+           << " inserts=" << inserts << " updates=" << updates << " evictions=" << evictions;
+        if (latency_percentile(CacheOp::Get, 1.0) || latency_percentile(CacheOp::Put, 1.0)) {
+            os << " get_p50<=" << latency_percentile(CacheOp::Get, 0.5) << "ns"
+               << " get_p99<=" << latency_percentile(CacheOp::Get, 0.99) << "ns"
+               << " put_p50<=" << latency_percentile(CacheOp::Put, 0.5) << "ns"
+               << " put_p99<=" << latency_percentile(CacheOp::Put, 0.99) << "ns";
+        }
+        os << "\n";
+    }
+};
+
+// ==========================
+// Disabled (default)
+// ==========================
+class NoCacheStats {
+public:
+    struct Timer {};
+
+    void record_hit() {}
+    void record_miss() {}
+    void record_insert() {}
+    void record_update() {}
+    void record_eviction() {}
+    Timer time(CacheOp) { return Timer{}; }
+
+    CacheStatsSnapshot snapshot() const { return CacheStatsSnapshot{}; }
+    void reset() {}
+};
+
+// ==========================
+// Counters only
+// ==========================
+class CacheStats {
+protected:
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+    std::atomic<std::uint64_t> inserts_{0};
+    std::atomic<std::uint64_t> updates_{0};
+    std::atomic<std::uint64_t> evictions_{0};
+
+    // single-writer increment: a plain add, published with relaxed ordering
+    static void bump(std::atomic<std::uint64_t> &c) {
+        c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    void fill(CacheStatsSnapshot &s) const {
+        s.hits = hits_.load(std::memory_order_relaxed);
+        s.misses = misses_.load(std::memory_order_relaxed);
+        s.inserts = inserts_.load(std::memory_order_relaxed);
+        s.updates = updates_.load(std::memory_order_relaxed);
+        s.evictions = evictions_.load(std::memory_order_relaxed);
+    }
+
+public:
+    struct Timer {};
+
+    void record_hit() { bump(hits_); }
+    void record_miss() { bump(misses_); }
+    void record_insert() { bump(inserts_); }
+    void record_update() { bump(updates_); }
+    void record_eviction() { bump(evictions_); }
+    Timer time(CacheOp) { return Timer{}; }
+
+    CacheStatsSnapshot snapshot() const {
+        CacheStatsSnapshot s;
+        fill(s);
+        return s;
+    }
+
+    void reset() {
+        hits_.store(0, std::memory_order_relaxed);
+        misses_.store(0, std::memory_order_relaxed);
+        inserts_.store(0, std::memory_order_relaxed);
+        updates_.store(0, std::memory_order_relaxed);
+        evictions_.store(0, std::memory_order_relaxed);
+    }
+};
+
+// ==========================
+// Counters + latency histograms
+// ==========================
+class TimedCacheStats : public CacheStats {
+private:
+    using clock = std::chrono::steady_clock;
+    static constexpr std::size_t BUCKETS = CacheStatsSnapshot::LATENCY_BUCKETS;
+
+    std::atomic<std::uint64_t> latency_[2][BUCKETS] = {};
+
+    void record_latency(CacheOp op, std::uint64_t ns) {
+        std::size_t b = 0;
+        while (ns > 1 && b + 1 < BUCKETS) { ns >>= 1; ++b; }
+        bump(latency_[static_cast<int>(op)][b]);
+    }
+
+public:
+    // RAII timer: records the elapsed time of the enclosing operation on destruction
+    class Timer {
+    private:
+        TimedCacheStats *owner_;
+        CacheOp op_;
+        clock::time_point start_;
+
+    public:
+        Timer(TimedCacheStats *owner, CacheOp op) : owner_(owner), op_(op), start_(clock::now()) {}
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+        ~Timer() {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start_).count();
+            owner_->record_latency(op_, ns > 0 ? static_cast<std::uint64_t>(ns) : 0);
+        }
+    };
+
+    Timer time(CacheOp op) { return Timer(this, op); }
+
+    CacheStatsSnapshot snapshot() const {
+        CacheStatsSnapshot s;
+        fill(s);
+        for (int op = 0; op < 2; ++op)
+            for (std::size_t i = 0; i < BUCKETS; ++i) s.latency[op][i] = latency_[op][i].load(std::memory_order_relaxed);
+        return s;
+    }
+
+    void reset() {
+        CacheStats::reset();
+        for (auto &row : latency_)
+            for (auto &c : row) c.store(0, std::memory_order_relaxed);
+    }
+};
+
+// ==========================
+// Storage for the policy inside a cache
+// ==========================
+// Caches inherit from this instead of holding a Stats member: an empty policy such as
+// NoCacheStats then occupies no bytes (empty base optimization), where a member would
+// still take one padded byte.
+template<typename Stats>
+class CacheStatsHolder : private Stats {
+protected:
+    Stats& stats_policy() { return *this; }
+    const Stats& stats_policy() const { return *this; }
+};
+
+#endif // CACHE_STATS_H
@@ -4,6 +4,9 @@
 #include <cstddef>
 #include <iostream>
 #include <initializer_list>
+#include <memory>
+#include <utility>
+#include "../allocators/node_alloc.h"
 
 // ===============================
 // Circular Singly Linked List
@@ -13,6 +16,7 @@
 // - Delete at head / tail / position
 // - Search by value
 // - Print the list (finite iteration)
+// - Nodes come from Alloc (std::allocator by default; see allocators/)
 // ===============================
 
 template<typename T>
@@ -22,7 +26,7 @@ struct CLLNode {
     CLLNode(const T &v) : val(v), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>>
 class CircularLinkedList {
 public:
     using Node = CLLNode<T>;
@@ -31,9 +35,13 @@ private:
     Node *tail;         // keep track of tail; head = tail->next (if exists)
     std::size_t len;
 
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    NodeAlloc alloc;
+
 public:
-    CircularLinkedList() : tail(nullptr), len(0) {}
-    CircularLinkedList(std::initializer_list<T> il) : tail(nullptr), len(0) {
+    CircularLinkedList() : tail(nullptr), len(0), alloc() {}
+    explicit CircularLinkedList(const Alloc &a) : tail(nullptr), len(0), alloc(a) {}
+    CircularLinkedList(std::initializer_list<T> il, const Alloc &a = Alloc()) : tail(nullptr), len(0), alloc(a) {
         for (const T &v : il) push_back(v);
     }
 
@@ -44,7 +52,7 @@ public:
     CircularLinkedList& operator=(const CircularLinkedList &) = delete;
 
     // Allow move
-    CircularLinkedList(CircularLinkedList &&other) noexcept {
+    CircularLinkedList(CircularLinkedList &&other) noexcept : alloc(std::move(other.alloc)) {
         tail = other.tail;
         len = other.len;
         other.tail = nullptr;
@@ -53,6 +61,7 @@ public:
     CircularLinkedList& operator=(CircularLinkedList &&other) noexcept {
         if (this != &other) {
             clear();
+            alloc = std::move(other.alloc);
             tail = other.tail;
             len = other.len;
             other.tail = nullptr;
@@ -69,7 +78,7 @@ public:
 
     // Insert at head
     void push_front(const T &v) {
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         if (!tail) {
             tail = n;
             n->next = n;
@@ -93,7 +102,7 @@ public:
         if (pos == len) { push_back(v); return true; }
         Node *cur = tail->next; // head
         for (std::size_t i = 0; i + 1 < pos; ++i) cur = cur->next;
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         n->next = cur->next;
         cur->next = n;
         ++len;
@@ -105,11 +114,11 @@ public:
         if (!tail) return false;
         Node *head = tail->next;
         if (head == tail) {
-            delete head;
+            nodealloc::destroy_node(alloc, head);
             tail = nullptr;
         } else {
             tail->next = head->next;
-            delete head;
+            nodealloc::destroy_node(alloc, head);
         }
         --len;
         return true;
@@ -120,13 +129,13 @@ public:
         if (!tail) return false;
         Node *head = tail->next;
         if (head == tail) {
-            delete tail;
+            nodealloc::destroy_node(alloc, tail);
             tail = nullptr;
         } else {
             Node *cur = head;
             while (cur->next != tail) cur = cur->next;
             cur->next = head;
-            delete tail;
+            nodealloc::destroy_node(alloc, tail);
             tail = cur;
         }
         --len;
@@ -142,7 +151,7 @@ public:
         for (std::size_t i = 0; i + 1 < pos; ++i) cur = cur->next;
         Node *target = cur->next;
         cur->next = target->next;
-        delete target;
+        nodealloc::destroy_node(alloc, target);
         --len;
         return true;
     }
@@ -165,7 +174,7 @@ public:
         Node *cur = head;
         for (std::size_t i = 0; i < len; ++i) {
             Node *nx = cur->next;
-            delete cur;
+            nodealloc::destroy_node(alloc, cur);
             cur = nx;
         }
         tail = nullptr;
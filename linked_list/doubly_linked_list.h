@@ -4,6 +4,9 @@
 #include <cstddef>
 #include <iostream>
 #include <initializer_list>
+#include <memory>
+#include <utility>
+#include "../allocators/node_alloc.h"
 
 // =========================
 // Doubly Linked List (DLL)
@@ -16,6 +19,7 @@
 //   • Clear the list
 //
 // Node is templated so any type can be stored.
+// Nodes come from Alloc (std::allocator by default; see allocators/).
 // =========================
 
 template<typename T>
@@ -26,7 +30,7 @@ struct DLLNode {
     DLLNode(const T &v) : val(v), prev(nullptr), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>>
 class DoublyLinkedList {
 public:
     using Node = DLLNode<T>;
@@ -36,10 +40,14 @@ private:
     Node *tail;
     std::size_t len;
 
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    NodeAlloc alloc;
+
 public:
     // Constructors
-    DoublyLinkedList() : head(nullptr), tail(nullptr), len(0) {}
-    DoublyLinkedList(std::initializer_list<T> il) : head(nullptr), tail(nullptr), len(0) {
+    DoublyLinkedList() : head(nullptr), tail(nullptr), len(0), alloc() {}
+    explicit DoublyLinkedList(const Alloc &a) : head(nullptr), tail(nullptr), len(0), alloc(a) {}
+    DoublyLinkedList(std::initializer_list<T> il, const Alloc &a = Alloc()) : head(nullptr), tail(nullptr), len(0), alloc(a) {
         for (const T &v : il) push_back(v);
     }
 
@@ -50,7 +58,7 @@ public:
     DoublyLinkedList& operator=(const DoublyLinkedList &) = delete;
 
     // Allow move
-    DoublyLinkedList(DoublyLinkedList &&other) noexcept {
+    DoublyLinkedList(DoublyLinkedList &&other) noexcept : alloc(std::move(other.alloc)) {
         head = other.head;
         tail = other.tail;
         len = other.len;
@@ -60,6 +68,7 @@ public:
     DoublyLinkedList& operator=(DoublyLinkedList &&other) noexcept {
         if (this != &other) {
             clear();
+            alloc = std::move(other.alloc);
             head = other.head;
             tail = other.tail;
             len = other.len;
@@ -78,7 +87,7 @@ public:
 
     // Insert at head
     void push_front(const T &v) {
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         n->next = head;
         if (head) head->prev = n;
         head = n;
@@ -88,7 +97,7 @@ public:
 
     // Insert at tail
     void push_back(const T &v) {
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         n->prev = tail;
         if (tail) tail->next = n;
         tail = n;
@@ -103,7 +112,7 @@ public:
         if (pos == len) { push_back(v); return true; }
         Node *cur = head;
         for (std::size_t i = 0; i < pos; ++i) cur = cur->next;
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         n->prev = cur->prev;
         n->next = cur;
         cur->prev->next = n;
@@ -119,7 +128,7 @@ public:
         head = head->next;
         if (head) head->prev = nullptr;
         else tail = nullptr;
-        delete tmp;
+        nodealloc::destroy_node(alloc, tmp);
         --len;
         return true;
     }
@@ -131,7 +140,7 @@ public:
         tail = tail->prev;
         if (tail) tail->next = nullptr;
         else head = nullptr;
-        delete tmp;
+        nodealloc::destroy_node(alloc, tmp);
         --len;
         return true;
     }
@@ -145,7 +154,7 @@ public:
         for (std::size_t i = 0; i < pos; ++i) cur = cur->next;
         cur->prev->next = cur->next;
         cur->next->prev = cur->prev;
-        delete cur;
+        nodealloc::destroy_node(alloc, cur);
         --len;
         return true;
     }
@@ -165,7 +174,7 @@ public:
         Node *cur = head;
         while (cur) {
             Node *nx = cur->next;
-            delete cur;
+            nodealloc::destroy_node(alloc, cur);
             cur = nx;
         }
         head = tail = nullptr;
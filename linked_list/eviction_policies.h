@@ -0,0 +1,412 @@
+#ifndef EVICTION_POLICIES_H
+#define EVICTION_POLICIES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "intrusive_list.h"
+
+/*
+  eviction_policies.h
+  - Pluggable eviction policies for PolicyCache (policy_cache.h)
+  - Every policy is a template over the cache's Entry type and keeps its bookkeeping
+    in an intrusive Hook stored inside each entry (entry->hook, type given by
+    policy_hook<Policy, Entry>). The list-based policies link entries with IntrusiveDList
+    (intrusive_list.h), the same list LRUCache uses. Entries also expose entry->hash
+    (already mixed). The interface is:
+      explicit Policy(size_t capacity)
+      void on_insert(Entry* e)      // new entry added after a miss
+      void on_hit(Entry* e)         // entry read or updated
+      void on_miss(size_t hash)     // lookup of an absent key (none of the built-in policies
+                                    // count it; a following insert is the same access)
+      void on_erase(Entry* e)       // entry removed explicitly
+      Entry* evict()                // called when the cache holds capacity + 1 entries;
+                                    // unlinks and returns the entry to drop (may be the new one)
+      void clear()
+  - Policies:
+      LRUPolicy      — recency list (move_to_front on hit, drop tail); also the one LRUCache
+                       itself is built on
+      ClockPolicy    — second-chance ring; a hit only sets a reference bit
+      SLRUPolicy     — segmented LRU (probation 20% / protected 80%), scan resistant
+      WTinyLFUPolicy — small LRU window + SLRU main space guarded by a count-min
+                       sketch admission filter
+*/
+
+namespace cachepolicy {
+
+// Hook type a policy keeps in every entry. PolicyCache looks it up through this trait rather
+// than Policy<Entry>::Hook: the list-based policies hold IntrusiveDList<Entry, &Entry::hook>
+// members, and those cannot be instantiated before Entry itself is complete.
+// Policies whose members don't name &Entry::hook need no specialization.
+template<template<typename> class Policy, typename Entry>
+struct policy_hook {
+    using type = typename Policy<Entry>::Hook;
+};
+
+enum class Segment : std::uint8_t { Window, Probation, Protected };
+
+// Links plus the segment an entry currently sits in (SLRU / W-TinyLFU)
+template<typename Entry>
+struct SegmentHook : DListHook<Entry> {
+    Segment segment = Segment::Probation;
+};
+
+// ==========================
+// LRU: IntrusiveDList relinking on every hit. LRUCache keeps its recency order in one of
+// these too, so the move-to-front / drop-tail logic exists only here.
+// ==========================
+template<typename Entry>
+class LRUPolicy {
+public:
+    using Hook = DListHook<Entry>;
+
+private:
+    IntrusiveDList<Entry, &Entry::hook> list_; // front = most recent
+
+public:
+    explicit LRUPolicy(std::size_t) {}
+
+    void on_insert(Entry* e) { list_.push_front(*e); }
+    void on_hit(Entry* e) { list_.move_to_front(*e); }
+    void on_miss(std::size_t) {}
+    void on_erase(Entry* e) { list_.remove(*e); }
+    Entry* evict() { return list_.pop_back(); }
+    void clear() { list_.clear(); }
+
+    // f(const Entry&) from most to least recent
+    template<typename F>
+    void for_each(F&& f) const { list_.for_each(std::forward<F>(f)); }
+};
+
+template<typename Entry>
+struct policy_hook<LRUPolicy, Entry> {
+    using type = DListHook<Entry>;
+};
+
+// ==========================
+// CLOCK (second chance)
+// ==========================
+// Entries sit in a fixed ring of capacity slots. A hit only sets the reference bit,
+// so reads never relink anything. The hand clears bits until it finds an unreferenced
+// victim; the new entry takes over that slot.
+template<typename Entry>
+class ClockPolicy {
+public:
+    struct Hook {
+        std::size_t slot = 0;
+        bool referenced = false;
+    };
+
+private:
+    std::vector<Entry*> ring_;
+    std::vector<std::size_t> free_slots_;
+    std::size_t capacity_;
+    std::size_t hand_;
+    Entry *pending_; // victim chosen by on_insert, handed out by evict()
+
+    // advance the hand to the next unreferenced entry and detach it; two full turns clear
+    // every reference bit, so finding nothing by then means the ring holds no entries
+    Entry* sweep() {
+        for (std::size_t step = 0, turns = 2 * ring_.size(); step < turns; ++step) {
+            Entry *e = ring_[hand_];
+            std::size_t at = hand_;
+            hand_ = (hand_ + 1 == ring_.size()) ? 0 : hand_ + 1;
+            if (!e) continue;
+            if (e->hook.referenced) {
+                e->hook.referenced = false;
+                continue;
+            }
+            ring_[at] = nullptr;
+            free_slots_.push_back(at);
+            return e;
+        }
+        return nullptr;
+    }
+
+public:
+    explicit ClockPolicy(std::size_t capacity)
+        : capacity_(capacity ? capacity : 1), hand_(0), pending_(nullptr) {
+        ring_.reserve(capacity_);
+        free_slots_.reserve(capacity_);
+    }
+
+    void on_insert(Entry* e) {
+        if (free_slots_.empty() && ring_.size() == capacity_) pending_ = sweep();
+        e->hook.referenced = false;
+        if (!free_slots_.empty()) {
+            e->hook.slot = free_slots_.back();
+            free_slots_.pop_back();
+            ring_[e->hook.slot] = e;
+        } else {
+            e->hook.slot = ring_.size();
+            ring_.push_back(e);
+        }
+    }
+
+    void on_hit(Entry* e) { e->hook.referenced = true; }
+    void on_miss(std::size_t) {}
+
+    void on_erase(Entry* e) {
+        ring_[e->hook.slot] = nullptr;
+        free_slots_.push_back(e->hook.slot);
+    }
+
+    Entry* evict() {
+        Entry *e = pending_;
+        pending_ = nullptr;
+        return e ? e : sweep();
+    }
+
+    void clear() {
+        ring_.clear();
+        free_slots_.clear();
+        hand_ = 0;
+        pending_ = nullptr;
+    }
+};
+
+// ==========================
+// Segmented LRU building block
+// ==========================
+// New entries start in probation; a second hit promotes them to protected.
+// Protected overflow is demoted back to the head of probation. One-hit wonders
+// (e.g. a sequential scan) therefore only ever churn the probation segment.
+template<typename Entry>
+class SegmentedLRU {
+private:
+    IntrusiveDList<Entry, &Entry::hook> probation_;
+    IntrusiveDList<Entry, &Entry::hook> protected_;
+    std::size_t protected_cap_;
+
+public:
+    explicit SegmentedLRU(std::size_t capacity)
+        : protected_cap_(capacity - capacity / 5) {}
+
+    std::size_t size() const { return probation_.size() + protected_.size(); }
+
+    void add(Entry* e) {
+        e->hook.segment = Segment::Probation;
+        probation_.push_front(*e);
+    }
+
+    void hit(Entry* e) {
+        if (e->hook.segment == Segment::Protected) {
+            protected_.move_to_front(*e);
+            return;
+        }
+        probation_.remove(*e);
+        e->hook.segment = Segment::Protected;
+        protected_.push_front(*e);
+        if (protected_.size() > protected_cap_) {
+            Entry *demoted = protected_.pop_back();
+            demoted->hook.segment = Segment::Probation;
+            probation_.push_front(*demoted);
+        }
+    }
+
+    void remove(Entry* e) {
+        if (e->hook.segment == Segment::Protected) protected_.remove(*e);
+        else probation_.remove(*e);
+    }
+
+    // next eviction candidate (probation tail first), not unlinked
+    Entry* victim() const {
+        if (!probation_.empty()) return probation_.back_ptr();
+        return protected_.back_ptr();
+    }
+
+    void clear() {
+        probation_.clear();
+        protected_.clear();
+    }
+};
+
+// ==========================
+// SLRU policy
+// ==========================
+template<typename Entry>
+class SLRUPolicy {
+public:
+    using Hook = SegmentHook<Entry>;
+
+private:
+    SegmentedLRU<Entry> slru_;
+
+public:
+    explicit SLRUPolicy(std::size_t capacity) : slru_(capacity ? capacity : 1) {}
+
+    void on_insert(Entry* e) { slru_.add(e); }
+    void on_hit(Entry* e) { slru_.hit(e); }
+    void on_miss(std::size_t) {}
+    void on_erase(Entry* e) { slru_.remove(e); }
+
+    Entry* evict() {
+        Entry *e = slru_.victim();
+        if (e) slru_.remove(e);
+        return e;
+    }
+
+    void clear() { slru_.clear(); }
+};
+
+template<typename Entry>
+struct policy_hook<SLRUPolicy, Entry> {
+    using type = SegmentHook<Entry>;
+};
+
+// ==========================
+// Count-min sketch (4 rows of saturating 8-bit counters, periodic halving)
+// ==========================
+class CountMinSketch {
+private:
+    std::vector<std::uint8_t> table_; // 4 rows * width
+    std::size_t mask_;                 // width - 1
+    std::size_t additions_;
+    std::size_t sample_size_;          // halve all counters after this many increments
+
+    static constexpr std::uint8_t MAX_COUNT = 15;
+
+    std::size_t index(std::uint64_t hash, unsigned row) const {
+        static constexpr std::uint64_t seeds[4] = {
+            0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+            0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+        std::uint64_t h = (hash + seeds[row]) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 32;
+        return row * (mask_ + 1) + (static_cast<std::size_t>(h) & mask_);
+    }
+
+    void age() {
+        for (auto &c : table_) c >>= 1;
+        additions_ /= 2;
+    }
+
+public:
+    explicit CountMinSketch(std::size_t capacity) : additions_(0) {
+        std::size_t width = 16;
+        while (width < capacity) width <<= 1;
+        mask_ = width - 1;
+        table_.assign(width * 4, 0);
+        sample_size_ = 10 * (capacity ? capacity : 1);
+    }
+
+    void increment(std::uint64_t hash) {
+        bool added = false;
+        for (unsigned r = 0; r < 4; ++r) {
+            std::uint8_t &c = table_[index(hash, r)];
+            if (c < MAX_COUNT) { ++c; added = true; }
+        }
+        if (added && ++additions_ >= sample_size_) age();
+    }
+
+    unsigned estimate(std::uint64_t hash) const {
+        unsigned best = MAX_COUNT;
+        for (unsigned r = 0; r < 4; ++r) {
+            unsigned c = table_[index(hash, r)];
+            if (c < best) best = c;
+        }
+        return best;
+    }
+
+    void clear() {
+        for (auto &c : table_) c = 0;
+        additions_ = 0;
+    }
+};
+
+// ==========================
+// W-TinyLFU
+// ==========================
+// A 1% LRU window absorbs bursts; entries leaving the window only enter the
+// 99% SLRU main space if the sketch says they are used more often than the
+// main space's own eviction victim.
+template<typename Entry>
+class WTinyLFUPolicy {
+public:
+    using Hook = SegmentHook<Entry>;
+
+private:
+    IntrusiveDList<Entry, &Entry::hook> window_;
+    SegmentedLRU<Entry> main_;
+    CountMinSketch sketch_;
+    std::size_t window_cap_;
+    std::size_t main_cap_;
+    Entry *pending_;
+
+    static std::size_t window_size_for(std::size_t capacity) {
+        std::size_t w = capacity / 100;
+        return w ? w : 1;
+    }
+
+public:
+    explicit WTinyLFUPolicy(std::size_t capacity)
+        : main_((capacity ? capacity : 1) - window_size_for(capacity ? capacity : 1)),
+          sketch_(capacity ? capacity : 1),
+          window_cap_(window_size_for(capacity ? capacity : 1)),
+          main_cap_((capacity ? capacity : 1) - window_cap_),
+          pending_(nullptr) {}
+
+    // Every access is counted exactly once: hits in on_hit, new keys here. A get() miss
+    // followed by put() of the same key is one access, so on_miss does not count.
+    void on_insert(Entry* e) {
+        sketch_.increment(e->hash);
+        e->hook.segment = Segment::Window;
+        window_.push_front(*e);
+        if (window_.size() <= window_cap_) return;
+
+        Entry *candidate = window_.pop_back();
+        if (main_.size() < main_cap_) {
+            main_.add(candidate);
+            return;
+        }
+        // main space full: admit the candidate only if it is hotter than the victim
+        Entry *victim = main_.victim();
+        if (victim && sketch_.estimate(candidate->hash) > sketch_.estimate(victim->hash)) {
+            main_.remove(victim);
+            main_.add(candidate);
+            pending_ = victim;
+        } else {
+            pending_ = candidate;
+        }
+    }
+
+    void on_hit(Entry* e) {
+        sketch_.increment(e->hash);
+        if (e->hook.segment == Segment::Window) window_.move_to_front(*e);
+        else main_.hit(e);
+    }
+
+    void on_miss(std::size_t) {}
+
+    void on_erase(Entry* e) {
+        if (e->hook.segment == Segment::Window) window_.remove(*e);
+        else main_.remove(e);
+    }
+
+    Entry* evict() {
+        Entry *e = pending_;
+        pending_ = nullptr;
+        if (!e) {
+            e = main_.victim();
+            if (e) main_.remove(e);
+            else e = window_.pop_back();
+        }
+        return e;
+    }
+
+    void clear() {
+        window_.clear();
+        main_.clear();
+        sketch_.clear();
+        pending_ = nullptr;
+    }
+};
+
+template<typename Entry>
+struct policy_hook<WTinyLFUPolicy, Entry> {
+    using type = SegmentHook<Entry>;
+};
+
+} // namespace cachepolicy
+
+#endif // EVICTION_POLICIES_H
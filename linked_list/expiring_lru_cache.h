@@ -0,0 +1,273 @@
+#ifndef EXPIRING_LRU_CACHE_H
+#define EXPIRING_LRU_CACHE_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include "intrusive_list.h"
+
+/*
+  expiring_lru_cache.h
+  - LRU cache with weighted capacity and per-entry expiry:
+      ExpiringLRUCache<Key, Value, Weigher = UnitWeigher, Clock = std::chrono::steady_clock>
+  - Capacity is a total weight: Weigher(key, value) returns an entry's cost (e.g. bytes).
+    With the default UnitWeigher every entry weighs 1, i.e. plain entry-count capacity.
+  - Each entry may carry a deadline (default TTL from the constructor or per put()).
+    Deadlines are kept in a hashed timer wheel (256 slots of `tick` width):
+      • get() drops an expired entry lazily when it is looked up
+      • put() and expire() advance the wheel and reclaim whole slots in one batch,
+        so expiry never walks the recency list
+  - Same layout as LRUCache: unordered_map + IntrusiveDList recency list (front = most recent).
+  - Methods:
+      ExpiringLRUCache(size_t max_weight, duration default_ttl = 0 (never), duration tick = 1s)
+      std::optional<Value> get(const Key& k)
+      bool put(const Key& k, const Value& v)                 // default TTL
+      bool put(const Key& k, const Value& v, duration ttl)   // ttl <= 0 -> never expires
+                                                             // false if the entry alone is heavier than max_weight
+      bool erase(const Key& k)
+      size_t expire()                                        // batch sweep, returns number reclaimed
+      void clear()
+      size_t size() const / size_t weight() const / size_t max_weight() const
+      void debug_print() const
+*/
+
+// Default weigher: every entry costs 1.
+struct UnitWeigher {
+    template<typename K, typename V>
+    std::size_t operator()(const K&, const V&) const { return 1; }
+};
+
+template<typename Key, typename Value, typename Weigher = UnitWeigher,
+         typename Clock = std::chrono::steady_clock>
+class ExpiringLRUCache {
+public:
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+private:
+    static constexpr std::size_t WHEEL_SLOTS = 256; // power of two
+    static constexpr std::size_t NO_SLOT = static_cast<std::size_t>(-1);
+
+    struct Node {
+        Key key;
+        Value value;
+        std::size_t weight;
+        time_point deadline;      // time_point::max() when the entry never expires
+        std::size_t slot;         // wheel slot or NO_SLOT
+        DListHook<Node> recency;
+        Node *wprev;              // wheel slot list
+        Node *wnext;
+        Node(const Key& k, const Value& v)
+            : key(k), value(v), weight(0), deadline(time_point::max()), slot(NO_SLOT),
+              wprev(nullptr), wnext(nullptr) {}
+    };
+
+    std::size_t max_weight_;
+    std::size_t weight_;
+    duration default_ttl_;
+    duration tick_;
+    time_point epoch_;
+    std::uint64_t swept_tick_;          // wheel slots up to this tick have been reclaimed
+    std::unordered_map<Key, Node*> map_;
+    IntrusiveDList<Node, &Node::recency> recency_; // most recently used first
+    Node *wheel_[WHEEL_SLOTS];
+    Weigher weigher_;
+
+    // ---- timer wheel ----
+
+    std::uint64_t tick_of(time_point tp) const {
+        if (tp <= epoch_) return 0;
+        return static_cast<std::uint64_t>((tp - epoch_) / tick_);
+    }
+
+    // First tick boundary at or after the deadline: once the wheel has swept that slot
+    // every deadline filed there has passed (or belongs to a later revolution).
+    std::uint64_t deadline_tick(time_point tp) const {
+        duration d = tp - epoch_;
+        std::uint64_t t = static_cast<std::uint64_t>(d / tick_);
+        if (d % tick_ != duration::zero()) ++t;
+        return t;
+    }
+
+    void wheel_link(Node* node) {
+        if (node->deadline == time_point::max()) return;
+        std::uint64_t t = deadline_tick(node->deadline);
+        if (t <= swept_tick_) t = swept_tick_ + 1; // slot already swept this revolution
+        std::size_t s = static_cast<std::size_t>(t & (WHEEL_SLOTS - 1));
+        node->slot = s;
+        node->wprev = nullptr;
+        node->wnext = wheel_[s];
+        if (wheel_[s]) wheel_[s]->wprev = node;
+        wheel_[s] = node;
+    }
+
+    void wheel_unlink(Node* node) {
+        if (node->slot == NO_SLOT) return;
+        if (node->wprev) node->wprev->wnext = node->wnext;
+        else wheel_[node->slot] = node->wnext;
+        if (node->wnext) node->wnext->wprev = node->wprev;
+        node->wprev = node->wnext = nullptr;
+        node->slot = NO_SLOT;
+    }
+
+    // reclaim expired entries filed in one slot; returns number removed
+    std::size_t sweep_slot(std::size_t s, time_point now) {
+        std::size_t removed = 0;
+        Node *cur = wheel_[s];
+        while (cur) {
+            Node *nx = cur->wnext;
+            if (cur->deadline <= now) {
+                destroy(cur);
+                ++removed;
+            }
+            cur = nx;
+        }
+        return removed;
+    }
+
+    std::size_t advance(time_point now) {
+        std::uint64_t now_tick = tick_of(now);
+        if (now_tick <= swept_tick_) return 0;
+        std::size_t removed = 0;
+        if (now_tick - swept_tick_ >= WHEEL_SLOTS) {
+            for (std::size_t s = 0; s < WHEEL_SLOTS; ++s) removed += sweep_slot(s, now);
+        } else {
+            for (std::uint64_t t = swept_tick_ + 1; t <= now_tick; ++t)
+                removed += sweep_slot(static_cast<std::size_t>(t & (WHEEL_SLOTS - 1)), now);
+        }
+        swept_tick_ = now_tick;
+        return removed;
+    }
+
+    // ---- entry lifetime ----
+
+    void destroy(Node* node) {
+        wheel_unlink(node);
+        recency_.remove(*node);
+        weight_ -= node->weight;
+        map_.erase(node->key);
+        delete node;
+    }
+
+    void evict_to_fit() {
+        while (weight_ > max_weight_ && !recency_.empty()) destroy(recency_.back_ptr());
+    }
+
+    time_point deadline_for(time_point now, duration ttl) const {
+        if (ttl <= duration::zero()) return time_point::max();
+        if (time_point::max() - now <= ttl) return time_point::max();
+        return now + ttl;
+    }
+
+public:
+    explicit ExpiringLRUCache(std::size_t max_weight = 100,
+                              duration default_ttl = duration::zero(),
+                              duration tick = std::chrono::seconds(1),
+                              Weigher weigher = Weigher())
+        : max_weight_(max_weight ? max_weight : 1), weight_(0), default_ttl_(default_ttl),
+          tick_(tick > duration::zero() ? tick : duration(1)), epoch_(Clock::now()),
+          swept_tick_(0), weigher_(weigher) {
+        for (auto &s : wheel_) s = nullptr;
+    }
+
+    ~ExpiringLRUCache() { clear(); }
+
+    // non-copyable (pointer ownership)
+    ExpiringLRUCache(const ExpiringLRUCache&) = delete;
+    ExpiringLRUCache& operator=(const ExpiringLRUCache&) = delete;
+
+    // Get value if present and not expired; moves entry to most-recent position.
+    std::optional<Value> get(const Key& k) {
+        auto it = map_.find(k);
+        if (it == map_.end()) return std::nullopt;
+        Node* node = it->second;
+        if (node->deadline != time_point::max() && node->deadline <= Clock::now()) {
+            destroy(node);
+            return std::nullopt;
+        }
+        recency_.move_to_front(*node);
+        return node->value;
+    }
+
+    // Put with the default TTL.
+    bool put(const Key& k, const Value& v) { return put(k, v, default_ttl_); }
+
+    // Put (insert or update) with an explicit TTL. Evicts least recent entries until the
+    // total weight fits. Returns false (and stores nothing) if v alone exceeds max_weight.
+    bool put(const Key& k, const Value& v, duration ttl) {
+        time_point now = Clock::now();
+        advance(now);
+
+        std::size_t w = weigher_(k, v);
+        auto it = map_.find(k);
+        if (w > max_weight_) {
+            if (it != map_.end()) destroy(it->second);
+            return false;
+        }
+
+        Node* node;
+        if (it != map_.end()) {
+            node = it->second;
+            node->value = v;
+            weight_ -= node->weight;
+            wheel_unlink(node);
+            recency_.move_to_front(*node);
+        } else {
+            node = new Node(k, v);
+            recency_.push_front(*node);
+            map_[k] = node;
+        }
+        node->weight = w;
+        weight_ += w;
+        node->deadline = deadline_for(now, ttl);
+        wheel_link(node);
+
+        evict_to_fit();
+        return true;
+    }
+
+    // Erase key if exists. Returns true if erased.
+    bool erase(const Key& k) {
+        auto it = map_.find(k);
+        if (it == map_.end()) return false;
+        destroy(it->second);
+        return true;
+    }
+
+    // Batch sweep: reclaim every entry whose deadline has passed in the elapsed wheel slots.
+    // Call periodically (e.g. from a housekeeping thread holding the cache's lock).
+    std::size_t expire() { return advance(Clock::now()); }
+
+    // Clear all entries
+    void clear() {
+        while (Node* node = recency_.pop_front()) delete node;
+        for (auto &s : wheel_) s = nullptr;
+        map_.clear();
+        weight_ = 0;
+    }
+
+    // Number of stored entries (may include expired ones not yet reclaimed)
+    std::size_t size() const { return map_.size(); }
+
+    // Current total weight / weight budget
+    std::size_t weight() const { return weight_; }
+    std::size_t max_weight() const { return max_weight_; }
+
+    // Debug helper: print keys from most->least recent
+    void debug_print(std::ostream& os = std::cout) const {
+        os << "LRU (most->least): [";
+        bool first = true;
+        recency_.for_each([&](const Node& n) {
+            if (!first) os << " , ";
+            os << n.key << "(w=" << n.weight << ")";
+            first = false;
+        });
+        os << "] weight=" << weight_ << "/" << max_weight_ << "\n";
+    }
+};
+
+#endif // EXPIRING_LRU_CACHE_H
@@ -0,0 +1,341 @@
+#ifndef FLAT_LRU_CACHE_H
+#define FLAT_LRU_CACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../common/bit_utils.h"
+
+/*
+  flat_lru_cache.h
+  - Fixed-capacity LRU cache: FlatLRUCache<Key, Value, Hash>
+  - Same behaviour as LRUCache, but nothing is allocated after construction:
+      • all nodes live in one preallocated array and link to each other with 32-bit indices
+      • the key index is a flat open-addressing table (linear probing, backward-shift
+        deletion) holding node indices instead of an std::unordered_map
+  - Evicting on a full cache reuses the tail node's slot in place.
+  - Methods:
+      FlatLRUCache(size_t capacity)
+      std::optional<Value> get(const Key& k)
+      void put(const Key& k, const Value& v)
+      void get_many(const Key* keys, size_t n, std::optional<Value>* out)  // batched, prefetching
+      void put_many(const std::pair<Key, Value>* items, size_t n)
+        (std::vector overloads of both are provided)
+      bool erase(const Key& k)
+      void clear()
+      size_t size() const / size_t capacity() const
+      void debug_print() const                    // prints keys from most->least recent
+*/
+
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatLRUCache {
+private:
+    static constexpr std::uint32_t NIL = 0xFFFFFFFFu;
+    static constexpr std::size_t NO_SLOT = static_cast<std::size_t>(-1);
+
+    struct Node {
+        Key key;
+        Value value;
+        std::uint32_t hash; // mixed hash, kept so probing/shifting never rehashes keys
+        std::uint32_t prev;
+        std::uint32_t next;
+        Node(const Key& k, const Value& v, std::uint32_t h)
+            : key(k), value(v), hash(h), prev(NIL), next(NIL) {}
+    };
+
+    Node *nodes_;                      // capacity_ slots, constructed on demand
+    std::vector<std::uint32_t> table_; // node index per slot or NIL (power-of-two size)
+    std::size_t table_mask_;
+    std::uint32_t capacity_;
+    std::uint32_t size_;
+    std::uint32_t used_;      // slots [0, used_) have been handed out at least once
+    std::vector<std::uint32_t> free_slots_; // erased slots below used_ (reserved up front)
+    std::uint32_t head_;      // most recently used
+    std::uint32_t tail_;      // least recently used
+    Hash hasher_;
+
+    // std::hash is the identity for integers on common standard libraries; linear probing
+    // needs the low bits to be well spread, so finalize the hash first.
+    std::uint32_t hash_of(const Key& k) const {
+        std::uint64_t x = static_cast<std::uint64_t>(hasher_(k));
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        return static_cast<std::uint32_t>(x);
+    }
+
+    // Returns table slot holding k, or NO_SLOT.
+    std::size_t find_slot(const Key& k, std::uint32_t h) const {
+        std::size_t empty;
+        return probe(k, h, empty);
+    }
+
+    // One probe run: slot holding k, or NO_SLOT with `empty` set to the free slot that ends
+    // the run (where k would be inserted as long as nothing is erased first).
+    std::size_t probe(const Key& k, std::uint32_t h, std::size_t &empty) const {
+        std::size_t i = h & table_mask_;
+        while (table_[i] != NIL) {
+            const Node &n = nodes_[table_[i]];
+            if (n.hash == h && n.key == k) return i;
+            i = (i + 1) & table_mask_;
+        }
+        empty = i;
+        return NO_SLOT;
+    }
+
+    void table_insert(std::uint32_t idx) {
+        std::size_t i = nodes_[idx].hash & table_mask_;
+        while (table_[i] != NIL) i = (i + 1) & table_mask_;
+        table_[i] = idx;
+    }
+
+    // Remove slot i and shift later members of the probe run back (no tombstones).
+    void table_erase_slot(std::size_t i) {
+        std::size_t j = i;
+        for (;;) {
+            j = (j + 1) & table_mask_;
+            if (table_[j] == NIL) break;
+            std::size_t home = nodes_[table_[j]].hash & table_mask_;
+            // move table_[j] into the hole at i unless its home lies cyclically in (i, j]
+            bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!stays) {
+                table_[i] = table_[j];
+                i = j;
+            }
+        }
+        table_[i] = NIL;
+    }
+
+    void table_erase(std::uint32_t idx) {
+        std::size_t i = nodes_[idx].hash & table_mask_;
+        while (table_[i] != idx) i = (i + 1) & table_mask_;
+        table_erase_slot(i);
+    }
+
+    // Batches are pipelined in chunks small enough that prefetched lines are still in L1.
+    static constexpr std::size_t BATCH_CHUNK = 16;
+
+    static void prefetch(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(p);
+#else
+        (void)p;
+#endif
+    }
+
+    // Two prefetch stages for a chunk of keys: hash everything and prefetch the home table
+    // slots, then (slots now cached) prefetch the node each home slot points at.
+    template<typename KeyAt>
+    void prefetch_chunk(KeyAt key_at, std::size_t cnt, std::uint32_t* hashes) const {
+        for (std::size_t i = 0; i < cnt; ++i) {
+            hashes[i] = hash_of(key_at(i));
+            prefetch(&table_[hashes[i] & table_mask_]);
+        }
+        for (std::size_t i = 0; i < cnt; ++i) {
+            std::uint32_t idx = table_[hashes[i] & table_mask_];
+            if (idx != NIL) prefetch(nodes_ + idx);
+        }
+    }
+
+    // add node to front (head)
+    void add_to_front(std::uint32_t idx) {
+        Node &n = nodes_[idx];
+        n.prev = NIL;
+        n.next = head_;
+        if (head_ != NIL) nodes_[head_].prev = idx;
+        head_ = idx;
+        if (tail_ == NIL) tail_ = idx;
+    }
+
+    // remove a node from the recency list
+    void remove_node(std::uint32_t idx) {
+        Node &n = nodes_[idx];
+        if (n.prev != NIL) nodes_[n.prev].next = n.next;
+        else head_ = n.next;
+        if (n.next != NIL) nodes_[n.next].prev = n.prev;
+        else tail_ = n.prev;
+        n.prev = n.next = NIL;
+    }
+
+    // move existing node to front
+    void move_to_front(std::uint32_t idx) {
+        if (idx == head_) return;
+        remove_node(idx);
+        add_to_front(idx);
+    }
+
+    // get() / put() with the key's hash already computed (the batched paths hash a whole
+    // chunk up front and pass the hashes through, so no key is hashed twice).
+    std::optional<Value> get_hashed(const Key& k, std::uint32_t h) {
+        std::size_t slot = find_slot(k, h);
+        if (slot == NO_SLOT) return std::nullopt;
+        std::uint32_t idx = table_[slot];
+        move_to_front(idx);
+        return nodes_[idx].value;
+    }
+
+    void put_hashed(const Key& k, const Value& v, std::uint32_t h) {
+        std::size_t empty = NO_SLOT;
+        std::size_t slot = probe(k, h, empty);
+        if (slot != NO_SLOT) {
+            std::uint32_t idx = table_[slot];
+            nodes_[idx].value = v;
+            move_to_front(idx);
+            return;
+        }
+
+        std::uint32_t idx;
+        if (size_ == capacity_) {
+            // full: recycle the least recently used node in place. The copies are made
+            // before anything is unlinked, so a throwing copy leaves the cache untouched.
+            Key nk(k);
+            Value nv(v);
+            idx = tail_;
+            table_erase(idx);
+            remove_node(idx);
+            Node &n = nodes_[idx];
+            try {
+                n.key = std::move(nk);
+                n.value = std::move(nv);
+            } catch (...) {
+                // the victim is already gone: release its slot so size_ stays accurate
+                n.~Node();
+                free_slots_.push_back(idx);   // never reallocates (reserved up front)
+                --size_;
+                throw;
+            }
+            n.hash = h;
+            empty = NO_SLOT;   // the eviction may have shifted the probe run: probe again
+        } else {
+            // construct first: if Node(k, v, h) throws, no slot has been taken yet
+            idx = free_slots_.empty() ? used_ : free_slots_.back();
+            ::new (static_cast<void*>(nodes_ + idx)) Node(k, v, h);
+            if (!free_slots_.empty()) free_slots_.pop_back();
+            else ++used_;
+            ++size_;
+        }
+        add_to_front(idx);
+        if (empty != NO_SLOT) table_[empty] = idx;
+        else table_insert(idx);
+    }
+
+public:
+    explicit FlatLRUCache(std::size_t capacity = 100)
+        : nodes_(nullptr), table_mask_(0), capacity_(0), size_(0), used_(0),
+          head_(NIL), tail_(NIL) {
+        if (capacity == 0) capacity = 1;
+        if (capacity >= (NIL >> 1)) throw std::length_error("FlatLRUCache: capacity too large");
+        capacity_ = static_cast<std::uint32_t>(capacity);
+        // keep load factor <= 0.5 so probe runs stay short
+        table_.assign(bitutil::next_pow2(capacity * 2), NIL);
+        table_mask_ = table_.size() - 1;
+        free_slots_.reserve(capacity_);
+        nodes_ = std::allocator<Node>().allocate(capacity_);
+    }
+
+    ~FlatLRUCache() {
+        clear();
+        std::allocator<Node>().deallocate(nodes_, capacity_);
+    }
+
+    // non-copyable (owns raw node storage)
+    FlatLRUCache(const FlatLRUCache&) = delete;
+    FlatLRUCache& operator=(const FlatLRUCache&) = delete;
+
+    // Get value if present; moves entry to most-recent position.
+    std::optional<Value> get(const Key& k) { return get_hashed(k, hash_of(k)); }
+
+    // Put (insert or update). Never allocates.
+    void put(const Key& k, const Value& v) { put_hashed(k, v, hash_of(k)); }
+
+    // Batched get: same results and recency order as calling get() on each key in turn,
+    // but a chunk's cache misses (table slot, then node) are issued together.
+    void get_many(const Key* keys, std::size_t n, std::optional<Value>* out) {
+        std::uint32_t hashes[BATCH_CHUNK];
+        for (std::size_t base = 0; base < n; base += BATCH_CHUNK) {
+            std::size_t cnt = (n - base < BATCH_CHUNK) ? n - base : BATCH_CHUNK;
+            const Key* chunk = keys + base;
+            prefetch_chunk([chunk](std::size_t i) -> const Key& { return chunk[i]; }, cnt, hashes);
+            for (std::size_t i = 0; i < cnt; ++i) out[base + i] = get_hashed(chunk[i], hashes[i]);
+        }
+    }
+
+    std::vector<std::optional<Value>> get_many(const std::vector<Key>& keys) {
+        std::vector<std::optional<Value>> out(keys.size());
+        get_many(keys.data(), keys.size(), out.data());
+        return out;
+    }
+
+    // Batched put: same final state as calling put() on each item in turn; keys are hashed
+    // once, in prefetch_chunk.
+    void put_many(const std::pair<Key, Value>* items, std::size_t n) {
+        std::uint32_t hashes[BATCH_CHUNK];
+        for (std::size_t base = 0; base < n; base += BATCH_CHUNK) {
+            std::size_t cnt = (n - base < BATCH_CHUNK) ? n - base : BATCH_CHUNK;
+            const std::pair<Key, Value>* chunk = items + base;
+            prefetch_chunk([chunk](std::size_t i) -> const Key& { return chunk[i].first; }, cnt, hashes);
+            for (std::size_t i = 0; i < cnt; ++i) put_hashed(chunk[i].first, chunk[i].second, hashes[i]);
+        }
+    }
+
+    void put_many(const std::vector<std::pair<Key, Value>>& items) {
+        put_many(items.data(), items.size());
+    }
+
+    // Erase key if exists. Returns true if erased.
+    bool erase(const Key& k) {
+        std::size_t slot = find_slot(k, hash_of(k));
+        if (slot == NO_SLOT) return false;
+        std::uint32_t idx = table_[slot];
+        table_erase_slot(slot);
+        remove_node(idx);
+        nodes_[idx].~Node();
+        free_slots_.push_back(idx);
+        --size_;
+        return true;
+    }
+
+    // Clear all entries (storage is kept)
+    void clear() {
+        std::uint32_t cur = head_;
+        while (cur != NIL) {
+            std::uint32_t nx = nodes_[cur].next;
+            nodes_[cur].~Node();
+            cur = nx;
+        }
+        head_ = tail_ = NIL;
+        size_ = used_ = 0;
+        free_slots_.clear();
+        std::fill(table_.begin(), table_.end(), NIL);
+    }
+
+    // Number of stored entries
+    std::size_t size() const { return size_; }
+
+    // Capacity
+    std::size_t capacity() const { return capacity_; }
+
+    // Debug helper: print keys from most->least recent
+    void debug_print(std::ostream& os = std::cout) const {
+        os << "LRU (most->least): [";
+        std::uint32_t cur = head_;
+        bool first = true;
+        while (cur != NIL) {
+            if (!first) os << " , ";
+            os << nodes_[cur].key;
+            first = false;
+            cur = nodes_[cur].next;
+        }
+        os << "]\n";
+    }
+};
+
+#endif // FLAT_LRU_CACHE_H
@@ -0,0 +1,394 @@
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cassert>
+#include <cstddef>
+
+/*
+  intrusive_list.h
+  - Intrusive lists: the links live inside the user's objects, the list never allocates,
+    copies or frees anything. An object can sit in several lists at once (one hook each).
+      SListHook<T>  { T* next; }             -> IntrusiveSList<T, &T::hook>
+      DListHook<T>  { T* prev; T* next; }    -> IntrusiveDList<T, &T::hook>   (null-terminated;
+                                                the hook may also derive from DListHook<T>)
+                                             -> IntrusiveCList<T, &T::hook>   (circular ring)
+  - The hook template argument is a pointer to the hook member, e.g.
+        struct Job {
+            int id;
+            DListHook<Job> by_age;
+            DListHook<Job> by_owner;
+        };
+        IntrusiveDList<Job, &Job::by_age> ages;
+        IntrusiveDList<Job, &Job::by_owner> owned;
+  - Ownership stays with the caller: objects must outlive their membership, and must be
+    removed (or the list cleared) before they are destroyed.
+  - Doubly linked variants unlink by reference in O(1); the singly linked list removes by
+    reference in O(n) (or O(1) with erase_after).
+*/
+
+template<typename T>
+struct SListHook {
+    T *next = nullptr;
+};
+
+template<typename T>
+struct DListHook {
+    T *prev = nullptr;
+    T *next = nullptr;
+};
+
+// ==========================
+// Singly linked
+// ==========================
+template<typename T, SListHook<T> T::*Hook>
+class IntrusiveSList {
+private:
+    T *head;
+    T *tail;
+    std::size_t len;
+
+    static SListHook<T>& hook(T &x) { return x.*Hook; }
+    static const SListHook<T>& hook(const T &x) { return x.*Hook; }
+
+public:
+    IntrusiveSList() : head(nullptr), tail(nullptr), len(0) {}
+    ~IntrusiveSList() { clear(); }
+
+    // non-copyable (an object can only be linked once per hook); moveable
+    IntrusiveSList(const IntrusiveSList&) = delete;
+    IntrusiveSList& operator=(const IntrusiveSList&) = delete;
+    IntrusiveSList(IntrusiveSList &&other) noexcept : head(other.head), tail(other.tail), len(other.len) {
+        other.head = other.tail = nullptr;
+        other.len = 0;
+    }
+    IntrusiveSList& operator=(IntrusiveSList &&other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head; tail = other.tail; len = other.len;
+            other.head = other.tail = nullptr;
+            other.len = 0;
+        }
+        return *this;
+    }
+
+    bool empty() const { return head == nullptr; }
+    std::size_t size() const { return len; }
+    T* front_ptr() const { return head; }
+    T* back_ptr() const { return tail; }
+    static T* next(const T &x) { return hook(x).next; }
+
+    void push_front(T &x) {
+        hook(x).next = head;
+        head = &x;
+        if (!tail) tail = &x;
+        ++len;
+    }
+
+    void push_back(T &x) {
+        hook(x).next = nullptr;
+        if (tail) hook(*tail).next = &x;
+        else head = &x;
+        tail = &x;
+        ++len;
+    }
+
+    // Link x right after pos (pos must be in this list)
+    void insert_after(T &pos, T &x) {
+        hook(x).next = hook(pos).next;
+        hook(pos).next = &x;
+        if (tail == &pos) tail = &x;
+        ++len;
+    }
+
+    // Unlink and return the front object (nullptr if empty)
+    T* pop_front() {
+        if (!head) return nullptr;
+        T *x = head;
+        head = hook(*x).next;
+        if (!head) tail = nullptr;
+        hook(*x).next = nullptr;
+        --len;
+        return x;
+    }
+
+    // Unlink and return the object after pos (nullptr if pos is the last one). O(1).
+    T* erase_after(T &pos) {
+        T *x = hook(pos).next;
+        if (!x) return nullptr;
+        hook(pos).next = hook(*x).next;
+        if (tail == x) tail = &pos;
+        hook(*x).next = nullptr;
+        --len;
+        return x;
+    }
+
+    // Unlink x by reference (O(n): the predecessor has to be found). Returns false if absent.
+    bool remove(T &x) {
+        if (head == &x) { pop_front(); return true; }
+        for (T *cur = head; cur; cur = hook(*cur).next) {
+            if (hook(*cur).next == &x) {
+                erase_after(*cur);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Unlink everything (objects themselves are untouched)
+    void clear() {
+        while (pop_front()) {}
+    }
+
+    template<typename F>
+    void for_each(F &&f) const {
+        for (T *cur = head; cur; cur = hook(*cur).next) f(*cur);
+    }
+};
+
+// ==========================
+// Doubly linked (null-terminated)
+// ==========================
+// Hook may also point at a member whose type derives from DListHook<T>, so a hook can carry
+// extra per-element state next to the links (e.g. which of several lists the element is in).
+template<typename T, auto Hook>
+class IntrusiveDList {
+private:
+    T *head;
+    T *tail;
+    std::size_t len;
+
+    static DListHook<T>& hook(T &x) { return x.*Hook; }
+    static const DListHook<T>& hook(const T &x) { return x.*Hook; }
+
+public:
+    IntrusiveDList() : head(nullptr), tail(nullptr), len(0) {}
+    ~IntrusiveDList() { clear(); }
+
+    // non-copyable (an object can only be linked once per hook); moveable
+    IntrusiveDList(const IntrusiveDList&) = delete;
+    IntrusiveDList& operator=(const IntrusiveDList&) = delete;
+    IntrusiveDList(IntrusiveDList &&other) noexcept : head(other.head), tail(other.tail), len(other.len) {
+        other.head = other.tail = nullptr;
+        other.len = 0;
+    }
+    IntrusiveDList& operator=(IntrusiveDList &&other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head; tail = other.tail; len = other.len;
+            other.head = other.tail = nullptr;
+            other.len = 0;
+        }
+        return *this;
+    }
+
+    bool empty() const { return head == nullptr; }
+    std::size_t size() const { return len; }
+    T* front_ptr() const { return head; }
+    T* back_ptr() const { return tail; }
+    static T* next(const T &x) { return hook(x).next; }
+    static T* prev(const T &x) { return hook(x).prev; }
+
+    // True if x is linked into this list (assumes x's hook is not used by another list)
+    bool contains(const T &x) const { return hook(x).prev || hook(x).next || head == &x; }
+
+    void push_front(T &x) {
+        hook(x).prev = nullptr;
+        hook(x).next = head;
+        if (head) hook(*head).prev = &x;
+        else tail = &x;
+        head = &x;
+        ++len;
+    }
+
+    void push_back(T &x) {
+        hook(x).next = nullptr;
+        hook(x).prev = tail;
+        if (tail) hook(*tail).next = &x;
+        else head = &x;
+        tail = &x;
+        ++len;
+    }
+
+    // Link x right before pos (pos must be in this list)
+    void insert_before(T &pos, T &x) {
+        if (&pos == head) { push_front(x); return; }
+        T *p = hook(pos).prev;
+        hook(x).prev = p;
+        hook(x).next = &pos;
+        hook(*p).next = &x;
+        hook(pos).prev = &x;
+        ++len;
+    }
+
+    // Unlink x by reference in O(1) (x must be in this list)
+    void remove(T &x) {
+        DListHook<T> &h = hook(x);
+        assert(contains(x));
+        if (h.prev) hook(*h.prev).next = h.next;
+        else head = h.next;
+        if (h.next) hook(*h.next).prev = h.prev;
+        else tail = h.prev;
+        h.prev = h.next = nullptr;
+        --len;
+    }
+
+    // Relink an element of this list at the front (LRU "touch")
+    void move_to_front(T &x) {
+        if (&x == head) return;
+        remove(x);
+        push_front(x);
+    }
+
+    void move_to_back(T &x) {
+        if (&x == tail) return;
+        remove(x);
+        push_back(x);
+    }
+
+    // Unlink and return the front / back object (nullptr if empty)
+    T* pop_front() {
+        T *x = head;
+        if (x) remove(*x);
+        return x;
+    }
+
+    T* pop_back() {
+        T *x = tail;
+        if (x) remove(*x);
+        return x;
+    }
+
+    // Unlink everything (objects themselves are untouched)
+    void clear() {
+        T *cur = head;
+        while (cur) {
+            T *nx = hook(*cur).next;
+            hook(*cur).prev = hook(*cur).next = nullptr;
+            cur = nx;
+        }
+        head = tail = nullptr;
+        len = 0;
+    }
+
+    template<typename F>
+    void for_each(F &&f) const {
+        for (T *cur = head; cur; cur = hook(*cur).next) f(*cur);
+    }
+};
+
+// ==========================
+// Circular doubly linked ring
+// ==========================
+// head is the "current" element; rotate() advances it (round-robin scheduling).
+template<typename T, DListHook<T> T::*Hook>
+class IntrusiveCList {
+private:
+    T *head;
+    std::size_t len;
+
+    static DListHook<T>& hook(T &x) { return x.*Hook; }
+    static const DListHook<T>& hook(const T &x) { return x.*Hook; }
+
+public:
+    IntrusiveCList() : head(nullptr), len(0) {}
+    ~IntrusiveCList() { clear(); }
+
+    // non-copyable (an object can only be linked once per hook); moveable
+    IntrusiveCList(const IntrusiveCList&) = delete;
+    IntrusiveCList& operator=(const IntrusiveCList&) = delete;
+    IntrusiveCList(IntrusiveCList &&other) noexcept : head(other.head), len(other.len) {
+        other.head = nullptr;
+        other.len = 0;
+    }
+    IntrusiveCList& operator=(IntrusiveCList &&other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head; len = other.len;
+            other.head = nullptr;
+            other.len = 0;
+        }
+        return *this;
+    }
+
+    bool empty() const { return head == nullptr; }
+    std::size_t size() const { return len; }
+    T* front_ptr() const { return head; }
+    T* back_ptr() const { return head ? hook(*head).prev : nullptr; }
+    // Neighbours wrap around the ring
+    static T* next(const T &x) { return hook(x).next; }
+    static T* prev(const T &x) { return hook(x).prev; }
+
+    // True if x is linked (ring hooks are never null while linked)
+    static bool is_linked(const T &x) { return hook(x).next != nullptr; }
+
+    // Insert before head, i.e. at the back of the ring
+    void push_back(T &x) {
+        if (!head) {
+            hook(x).prev = hook(x).next = &x;
+            head = &x;
+        } else {
+            T *last = hook(*head).prev;
+            hook(x).prev = last;
+            hook(x).next = head;
+            hook(*last).next = &x;
+            hook(*head).prev = &x;
+        }
+        ++len;
+    }
+
+    void push_front(T &x) {
+        push_back(x);
+        head = &x;
+    }
+
+    // Unlink x by reference in O(1) (x must be in this ring)
+    void remove(T &x) {
+        DListHook<T> &h = hook(x);
+        assert(is_linked(x));
+        if (h.next == &x) {
+            head = nullptr;
+        } else {
+            hook(*h.prev).next = h.next;
+            hook(*h.next).prev = h.prev;
+            if (head == &x) head = h.next;
+        }
+        h.prev = h.next = nullptr;
+        --len;
+    }
+
+    T* pop_front() {
+        T *x = head;
+        if (x) remove(*x);
+        return x;
+    }
+
+    // Advance head by one step (the old head becomes the back)
+    void rotate() {
+        if (head) head = hook(*head).next;
+    }
+
+    // Unlink everything (objects themselves are untouched)
+    void clear() {
+        T *cur = head;
+        for (std::size_t i = 0; i < len; ++i) {
+            T *nx = hook(*cur).next;
+            hook(*cur).prev = hook(*cur).next = nullptr;
+            cur = nx;
+        }
+        head = nullptr;
+        len = 0;
+    }
+
+    // Visit each element once, starting at head
+    template<typename F>
+    void for_each(F &&f) const {
+        T *cur = head;
+        for (std::size_t i = 0; i < len; ++i) {
+            T *nx = hook(*cur).next;
+            f(*cur);
+            cur = nx;
+        }
+    }
+};
+
+#endif // INTRUSIVE_LIST_H
@@ -6,6 +6,7 @@
 #include <cassert>
 #include <functional>
 #include "singly_linked_list.h" // expects SLLNode<T> and SinglyLinkedList<T>
+#include "slab_linked_list.h"
 
 //
 // linked_list_algorithms.h
@@ -14,11 +15,14 @@
 // - Merge two sorted lists (in-place, reuses nodes)
 // - Remove nth node from end
 // - Find middle node
-// - MergeSort on linked list
+// - MergeSort on linked list (top-down, and bottom-up natural merge sort)
 //
 // All functions are templates over T and operate on SLLNode<T>* (raw head pointer).
 // They return SLLNode<T>* when they produce a new head, or useful values (bool, pointer).
 //
+// Overloads at the bottom run the same algorithms on SlabLinkedList<T> (index links;
+// functions that return a node return its slab index, NIL for none).
+//
 
 namespace llist {
 
@@ -86,46 +90,47 @@ SLLNode<T>* detect_cycle_entry(SLLNode<T>* head) {
 // Assumes l1 and l2 are heads of sorted lists.
 template<typename T>
 SLLNode<T>* merge_two_sorted(SLLNode<T>* l1, SLLNode<T>* l2) {
-    SLLNode<T> dummy(T()); // requires T default-constructible
-    SLLNode<T>* tail = &dummy;
+    SLLNode<T>* head = nullptr;
+    SLLNode<T>** link = &head; // where the next node gets attached
     while (l1 && l2) {
         if (l1->val <= l2->val) {
-            tail->next = l1;
+            *link = l1;
             l1 = l1->next;
         } else {
-            tail->next = l2;
+            *link = l2;
             l2 = l2->next;
         }
-        tail = tail->next;
+        link = &(*link)->next;
     }
-    tail->next = l1 ? l1 : l2;
-    return dummy.next;
+    *link = l1 ? l1 : l2;
+    return head;
 }
 
-// Remove nth node from end (1-based n). Returns new head (head may change) and a bool indicating success.
-// This is a raw-pointer variant.
+// Remove nth node from end (1-based n). Returns (new head, unlinked node); the node is
+// nullptr if the list has fewer than n nodes. The node is not freed: it came from whatever
+// allocator built the list, so the caller hands it back there (SinglyLinkedList has its own
+// remove_nth_from_end that does this).
 template<typename T>
-std::pair<SLLNode<T>*, bool> remove_nth_from_end(SLLNode<T>* head, std::size_t n) {
-    if (n == 0) return {head, false};
-    SLLNode<T> dummy(T());
+std::pair<SLLNode<T>*, SLLNode<T>*> remove_nth_from_end(SLLNode<T>* head, std::size_t n) {
+    if (n == 0) return {head, nullptr};
+    SLLNode<T> dummy{T()}; // requires T default-constructible
     dummy.next = head;
     SLLNode<T>* fast = &dummy;
     SLLNode<T>* slow = &dummy;
     // advance fast by n+1 steps
     for (std::size_t i = 0; i < n + 1; ++i) {
-        if (!fast) return {head, false};
+        if (!fast) return {head, nullptr};
         fast = fast->next;
     }
     while (fast) {
         fast = fast->next;
         slow = slow->next;
     }
-    SLLNode<T>* to_delete = slow->next;
-    if (!to_delete) return {head, false};
-    slow->next = to_delete->next;
-    // Note: caller is responsible for deleting node if desired; we will delete to avoid leaks
-    delete to_delete;
-    return {dummy.next, true};
+    SLLNode<T>* removed = slow->next;
+    if (!removed) return {head, nullptr};
+    slow->next = removed->next;
+    removed->next = nullptr;
+    return {dummy.next, removed};
 }
 
 // Find middle node: returns pointer to middle (if even length, returns first middle)
@@ -163,52 +168,207 @@ SLLNode<T>* mergesort_list(SLLNode<T>* head) {
     return merge_two_sorted<T>(left, right);
 }
 
+namespace detail {
+
+// Bottom-up natural merge sort over any singly linked chain ending in nil.
+// - next(h) returns a reference to h's link, value(h) its key; Handle is a node pointer
+//   or a slab index. Returns the new head and, if tail_out is given, the new tail.
+// - Splits the chain into maximal runs (non-decreasing runs as they are, strictly
+//   decreasing runs reversed) in a single pass, so sorted / reverse-sorted / nearly
+//   sorted input costs close to O(n).
+// - Runs are merged like a binary counter through pending[k]; no recursion, no split
+//   walks, no allocation. 64 slots cover any list that fits in memory.
+template<typename Handle, typename Next, typename Value>
+Handle natural_merge_sort(Handle head, Handle nil, Next next, Value value, Handle* tail_out) {
+    // merge run a (ends at *a_tail, precedes b) with run b (ends at b_tail);
+    // the merged tail is written back through a_tail
+    auto merge = [&](Handle a, Handle* a_tail, Handle b, Handle b_tail) {
+        Handle out = nil;
+        Handle* link = &out;
+        while (a != nil && b != nil) {
+            if (!(value(b) < value(a))) { *link = a; a = next(a); }
+            else { *link = b; b = next(b); }
+            link = &next(*link);
+        }
+        *link = a != nil ? a : b;
+        if (a == nil) *a_tail = b_tail; // b's leftover (or b's last merged node) ends the list
+        return out;
+    };
+
+    constexpr std::size_t MAX_PENDING = 64;
+    Handle pending[MAX_PENDING];
+    Handle pending_tail[MAX_PENDING];
+    for (std::size_t k = 0; k < MAX_PENDING; ++k) pending[k] = pending_tail[k] = nil;
+
+    while (head != nil) {
+        // cut the next run off the front of the list
+        Handle run = head;
+        Handle run_tail = head;
+        if (next(head) != nil && value(next(head)) < value(head)) {
+            // strictly decreasing: reverse while cutting (no equal keys, so stability holds)
+            Handle cur = next(head);
+            next(run) = nil;
+            while (cur != nil && value(cur) < value(run)) {
+                Handle nx = next(cur);
+                next(cur) = run;
+                run = cur;
+                cur = nx;
+            }
+            head = cur;
+        } else {
+            while (next(run_tail) != nil && !(value(next(run_tail)) < value(run_tail)))
+                run_tail = next(run_tail);
+            head = next(run_tail);
+            next(run_tail) = nil;
+        }
+
+        // carry: merge with pending runs of the same rank (older run on the left)
+        std::size_t k = 0;
+        for (; k + 1 < MAX_PENDING && pending[k] != nil; ++k) {
+            run = merge(pending[k], &pending_tail[k], run, run_tail);
+            run_tail = pending_tail[k];
+            pending[k] = nil;
+        }
+        if (pending[k] != nil) {
+            run = merge(pending[k], &pending_tail[k], run, run_tail);
+            run_tail = pending_tail[k];
+        }
+        pending[k] = run;
+        pending_tail[k] = run_tail;
+    }
+
+    // fold the remaining runs; higher slots hold earlier parts of the list
+    Handle result = nil;
+    Handle result_tail = nil;
+    for (std::size_t k = 0; k < MAX_PENDING; ++k) {
+        if (pending[k] == nil) continue;
+        if (result == nil) { result = pending[k]; result_tail = pending_tail[k]; }
+        else {
+            result = merge(pending[k], &pending_tail[k], result, result_tail);
+            result_tail = pending_tail[k];
+        }
+    }
+    if (tail_out) *tail_out = result_tail;
+    return result;
+}
+
+} // namespace detail
+
+// Bottom-up natural merge sort: returns new head of sorted list (ascending, stable).
+// See detail::natural_merge_sort; if tail_out is given it receives the last node.
+template<typename T>
+SLLNode<T>* mergesort_list_bottom_up(SLLNode<T>* head, SLLNode<T>** tail_out = nullptr) {
+    return detail::natural_merge_sort<SLLNode<T>*>(
+        head, nullptr,
+        [](SLLNode<T>* n) -> SLLNode<T>*& { return n->next; },
+        [](SLLNode<T>* n) -> const T& { return n->val; },
+        tail_out);
+}
+
 // Wrapper helpers that operate on SinglyLinkedList<T> class directly:
 
 // Reverse list stored in SinglyLinkedList in-place (iterative)
-template<typename T>
-void reverse_iterative(SinglyLinkedList<T> &list) {
-    SLLNode<T>* new_head = reverse_iterative<T>(list.get_head());
-    // update list's head and tail
-    // find new tail (old head). We cannot access private tail directly; SinglyLinkedList provided get_tail only.
-    // So we will reconstruct tail by iterating.
-    // Note: this requires SinglyLinkedList to expose mutable head; since SinglyLinkedList earlier provided get_head(),
-    // but not setter, we'll rely on assumption that user will set via internal operations. Instead, we can rebuild the list:
-    // (Safer approach: detach nodes and rebuild SinglyLinkedList by clearing and pushing nodes from new_head).
-    // Here we will reconstruct the SinglyLinkedList by clearing and pushing nodes (since class provides push_back).
-    if (!new_head) { list.clear(); return; }
-    // collect values then rebuild list
-    std::vector<T> vals;
-    for (SLLNode<T>* cur = new_head; cur; cur = cur->next) vals.push_back(cur->val);
-    list.clear();
-    for (const T &v : vals) list.push_back(v);
-    // delete nodes from new_head because we copied values into list (to avoid double-free or leak, we should free nodes)
-    SLLNode<T>* cur = new_head;
-    while (cur) {
-        SLLNode<T>* nx = cur->next;
-        delete cur;
-        cur = nx;
+template<typename T, typename A>
+void reverse_iterative(SinglyLinkedList<T, A> &list) {
+    list.reverse_iterative();
+}
+
+// Sort SinglyLinkedList in-place with the bottom-up natural merge sort.
+// Nodes are relinked, never copied or reallocated; head and tail are updated.
+template<typename T, typename A>
+void mergesort_list(SinglyLinkedList<T, A> &list) {
+    SLLNode<T>* tail = nullptr;
+    SLLNode<T>* head = mergesort_list_bottom_up<T>(list.get_head(), &tail);
+    list.set_links(head, tail);
+}
+
+// ==========================
+// SlabLinkedList overloads
+// ==========================
+// Same algorithms on index-linked nodes. Chains are identified by their head index and
+// must live in the same slab.
+
+template<typename T, typename A>
+void reverse_iterative(SlabLinkedList<T, A> &list) {
+    list.reverse_iterative();
+}
+
+// Floyd on indices
+template<typename T, typename A>
+bool has_cycle(const SlabLinkedList<T, A> &list) {
+    using L = SlabLinkedList<T, A>;
+    typename L::index_type slow = list.get_head();
+    typename L::index_type fast = slow;
+    while (fast != L::NIL && list.next(fast) != L::NIL) {
+        slow = list.next(slow);
+        fast = list.next(list.next(fast));
+        if (slow == fast) return true;
     }
+    return false;
 }
 
-// Sort SinglyLinkedList in-place using mergesort (rebuilds list)
-template<typename T>
-void mergesort_list(SinglyLinkedList<T> &list) {
-    SLLNode<T>* head = list.get_head();
-    if (!head) return;
-    SLLNode<T>* sorted = mergesort_list<T>(head);
-    // rebuild list from sorted nodes' values
-    std::vector<T> vals;
-    for (SLLNode<T>* cur = sorted; cur; cur = cur->next) vals.push_back(cur->val);
-    list.clear();
-    for (const T &v : vals) list.push_back(v);
-    // free nodes from sorted
-    SLLNode<T>* cur = sorted;
-    while (cur) {
-        SLLNode<T>* nx = cur->next;
-        delete cur;
-        cur = nx;
+// Merge two sorted chains of the slab; returns the head index of the merged chain.
+template<typename T, typename A>
+typename SlabLinkedList<T, A>::index_type
+merge_two_sorted(SlabLinkedList<T, A> &list, typename SlabLinkedList<T, A>::index_type l1,
+                 typename SlabLinkedList<T, A>::index_type l2) {
+    using L = SlabLinkedList<T, A>;
+    typename L::index_type head = L::NIL, tail = L::NIL;
+    while (l1 != L::NIL && l2 != L::NIL) {
+        typename L::index_type pick;
+        if (list.value(l1) <= list.value(l2)) { pick = l1; l1 = list.next(l1); }
+        else { pick = l2; l2 = list.next(l2); }
+        if (tail == L::NIL) head = pick;
+        else list.node(tail).next = pick;
+        tail = pick;
+    }
+    typename L::index_type rest = l1 != L::NIL ? l1 : l2;
+    if (tail == L::NIL) return rest;
+    list.node(tail).next = rest;
+    return head;
+}
+
+// Middle of the chain starting at head (first middle when even)
+template<typename T, typename A>
+typename SlabLinkedList<T, A>::index_type
+find_middle(const SlabLinkedList<T, A> &list, typename SlabLinkedList<T, A>::index_type head) {
+    using L = SlabLinkedList<T, A>;
+    if (head == L::NIL) return L::NIL;
+    typename L::index_type slow = head;
+    typename L::index_type fast = list.next(head);
+    while (fast != L::NIL && list.next(fast) != L::NIL) {
+        slow = list.next(slow);
+        fast = list.next(list.next(fast));
     }
+    return slow;
+}
+
+template<typename T, typename A>
+typename SlabLinkedList<T, A>::index_type find_middle(const SlabLinkedList<T, A> &list) {
+    return find_middle(list, list.get_head());
+}
+
+// Sort a chain of the slab with the bottom-up natural merge sort (stable, no recursion);
+// returns the new head index and, if tail_out is given, the new tail.
+template<typename T, typename A>
+typename SlabLinkedList<T, A>::index_type
+mergesort_list(SlabLinkedList<T, A> &list, typename SlabLinkedList<T, A>::index_type head,
+               typename SlabLinkedList<T, A>::index_type* tail_out = nullptr) {
+    using L = SlabLinkedList<T, A>;
+    using I = typename L::index_type;
+    return detail::natural_merge_sort<I>(
+        head, L::NIL,
+        [&list](I i) -> I& { return list.node(i).next; },
+        [&list](I i) -> const T& { return list.value(i); },
+        tail_out);
+}
+
+// Sort the whole list in place (relinks nodes, no copies)
+template<typename T, typename A>
+void mergesort_list(SlabLinkedList<T, A> &list) {
+    typename SlabLinkedList<T, A>::index_type tail = SlabLinkedList<T, A>::NIL;
+    typename SlabLinkedList<T, A>::index_type head = mergesort_list(list, list.get_head(), &tail);
+    list.set_links(head, tail);
 }
 
 } // namespace llist
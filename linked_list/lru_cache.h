@@ -2,78 +2,211 @@
 #define LRU_CACHE_H
 
 #include <cstddef>
+#include <functional>
 #include <unordered_map>
 #include <utility>
 #include <iostream>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "cache_stats.h"
+#include "eviction_policies.h"
 
 /*
   lru_cache.h
-  - Template LRU cache: LRUCache<Key, Value>
+  - Template LRU cache: LRUCache<Key, Value, Stats = NoCacheStats, Hash, KeyEqual>
   - O(1) get and put using doubly-linked list + unordered_map
+    (recency is kept by cachepolicy::LRUPolicy, the same policy PolicyCache uses: an
+    IntrusiveDList threaded through the nodes, see eviction_policies.h / intrusive_list.h)
+  - Stats policy (cache_stats.h): NoCacheStats compiles all instrumentation out;
+    CacheStats / TimedCacheStats count hits, misses, inserts, updates, evictions (+ latency)
+  - With a transparent Hash/KeyEqual (e.g. TransparentStringHash + std::equal_to<>, see
+    StringLRUCache) get/get_ptr/erase accept any comparable key type such as std::string_view
+    without building a Key (needs C++20 library support; otherwise a temporary Key is built).
   - Methods:
       LRUCache(size_t capacity)
       ~LRUCache()
-      std::optional<Value> get(const Key& k)       // returns value if found
+      std::optional<Value> get(const Key& k)       // returns a copy of the value if found
+      Value* get_ptr(const Key& k)                // pointer to the cached value or nullptr;
+                                                  // valid until that entry is evicted, erased
+                                                  // or the cache is cleared
       void put(const Key& k, const Value& v)      // insert or update
+      void put(Key&& k, Value&& v)                // moving insert / update
+      Value& emplace(K&& k, Args&&... args)       // insert: value built in the node;
+                                                  // update: built, then move-assigned
+      void get_many(const Key* keys, size_t n, std::optional<Value>* out)  // batched get
+      void put_many(const std::pair<Key, Value>* items, size_t n)         // batched put
+        (each key is hashed once; its bucket is prefetched before the chunk is walked)
+        (std::vector overloads of both are provided)
       bool erase(const Key& k)                    // remove key, returns whether removed
       void clear()                                // clear all entries
       void debug_print() const                    // prints keys from most->least recent
+      void for_each(F f) const                    // f(key, value) from most->least recent
+      CacheStatsSnapshot stats() const            // counters (all zero with NoCacheStats)
+      void reset_stats()
 */
 
-template<typename Key, typename Value>
-class LRUCache {
+// Hash for std::string keys that also accepts std::string_view / const char* lookups.
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view s) const { return std::hash<std::string_view>{}(s); }
+};
+
+template<typename Key, typename Value, typename Stats = NoCacheStats,
+         typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class LRUCache : private CacheStatsHolder<Stats> {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+
 private:
     struct Node {
         Key key;
         Value value;
-        Node *prev;
-        Node *next;
-        Node(const Key& k, const Value& v) : key(k), value(v), prev(nullptr), next(nullptr) {}
+        DListHook<Node> hook;
+        template<typename K, typename... Args>
+        Node(K&& k, Args&&... args)
+            : key(std::forward<K>(k)), value(std::forward<Args>(args)...) {}
     };
 
+    using RecencyList = cachepolicy::LRUPolicy<Node>;
+
+    template<typename T, typename = void>
+    struct has_is_transparent : std::false_type {};
+    template<typename T>
+    struct has_is_transparent<T, std::void_t<typename T::is_transparent>> : std::true_type {};
+
+    // Heterogeneous overloads only exist for transparent Hash + KeyEqual and non-Key arguments.
+    template<typename K>
+    using enable_if_heterogeneous = std::enable_if_t<
+        has_is_transparent<Hash>::value && has_is_transparent<KeyEqual>::value &&
+        !std::is_same<std::decay_t<K>, Key>::value>;
+
+    // the Stats policy is an (empty-base-optimized) base class, see CacheStatsHolder
+    using CacheStatsHolder<Stats>::stats_policy;
+
     size_t capacity_;
-    std::unordered_map<Key, Node*> map_;
-    Node *head_; // most recently used
-    Node *tail_; // least recently used
-
-    // add node to front (head)
-    void add_to_front(Node* node) {
-        node->prev = nullptr;
-        node->next = head_;
-        if (head_) head_->prev = node;
-        head_ = node;
-        if (!tail_) tail_ = node;
-    }
-
-    // remove a node from list (node assumed non-null)
-    void remove_node(Node* node) {
-        if (!node) return;
-        if (node->prev) node->prev->next = node->next;
-        else head_ = node->next;
-        if (node->next) node->next->prev = node->prev;
-        else tail_ = node->prev;
-        node->prev = node->next = nullptr;
-    }
-
-    // move existing node to front
-    void move_to_front(Node* node) {
-        if (node == head_) return;
-        remove_node(node);
-        add_to_front(node);
-    }
-
-    // pop tail and return pointer (or nullptr if empty)
-    Node* pop_tail() {
-        Node* node = tail_;
-        if (!node) return nullptr;
-        remove_node(node);
+    std::unordered_map<Key, Node*, Hash, KeyEqual> map_;
+    RecencyList recency_; // most recently used first; evict() drops the least recent
+
+    // Batches are resolved in chunks small enough that prefetched lines are still in L1.
+    static constexpr size_t BATCH_CHUNK = 16;
+
+    static void prefetch(const void* p) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(p);
+#else
+        (void)p;
+#endif
+    }
+
+    template<typename K>
+    auto find_it(const K& k) {
+#if defined(__cpp_lib_generic_unordered_lookup)
+        return map_.find(k);
+#else
+        if constexpr (std::is_same<K, Key>::value) return map_.find(k);
+        else return map_.find(Key(k));
+#endif
+    }
+
+    // lookup + hit/miss accounting + move to front; nullptr if absent
+    template<typename K>
+    Node* touch(const K& k) {
+        auto it = find_it(k);
+        if (it == map_.end()) {
+            stats_policy().record_miss();
+            return nullptr;
+        }
+        stats_policy().record_hit();
+        Node* node = it->second;
+        recency_.on_hit(node);
+        return node;
+    }
+
+    // Update path: a Value argument is assigned straight over the old value; anything else
+    // builds a Value first and move-assigns it.
+    template<typename... Args>
+    static void assign_value(Value& dst, Args&&... args) {
+        if constexpr (sizeof...(Args) == 1 && std::conjunction<std::is_same<std::decay_t<Args>, Value>...>::value)
+            dst = (std::forward<Args>(args), ...);
+        else
+            dst = Value(std::forward<Args>(args)...);
+    }
+
+    // Shared insert-or-update path; args are the value's constructor arguments.
+    // A key of another type is looked up as is when Hash and KeyEqual are transparent
+    // (find_it); otherwise the Key is built once here and that Key is looked up and moved in.
+    template<typename K, typename... Args>
+    Node* upsert(K&& k, Args&&... args) {
+        if constexpr (std::is_same<std::decay_t<K>, Key>::value ||
+                      (has_is_transparent<Hash>::value && has_is_transparent<KeyEqual>::value)) {
+            [[maybe_unused]] auto timer = stats_policy().time(CacheOp::Put);
+            auto it = find_it(k);
+            return upsert_found(it == map_.end() ? nullptr : it->second, std::forward<K>(k),
+                                std::forward<Args>(args)...);
+        } else {
+            return upsert(Key(std::forward<K>(k)), std::forward<Args>(args)...);
+        }
+    }
+
+    // Second half of upsert, once the lookup is done (existing = node of k, or nullptr).
+    template<typename K, typename... Args>
+    Node* upsert_found(Node* existing, K&& k, Args&&... args) {
+        if (existing) {
+            // update existing
+            assign_value(existing->value, std::forward<Args>(args)...);
+            recency_.on_hit(existing);
+            stats_policy().record_update();
+            return existing;
+        }
+        // insert new: key and value are constructed in the node (the key possibly moved in),
+        // the index keeps a copy of the key. The node is linked only once the index holds it.
+        Node* node = new Node(std::forward<K>(k), std::forward<Args>(args)...);
+        try {
+            map_.emplace(node->key, node);
+        } catch (...) {
+            delete node;
+            throw;
+        }
+        recency_.on_insert(node);
+        stats_policy().record_insert();
+
+        if (map_.size() > capacity_) {
+            Node* old = recency_.evict();
+            if (old) {
+                map_.erase(old->key);
+                delete old;
+                stats_policy().record_eviction();
+            }
+        }
         return node;
     }
 
+    // Lookup in bucket b, computed earlier with map_.bucket(k): walks the bucket's nodes
+    // without hashing k again. Buckets stay valid because the map is reserved for
+    // capacity + 1 entries up front and never rehashes.
+    Node* find_in_bucket(const Key& k, size_t b) const {
+        for (auto it = map_.begin(b), end = map_.end(b); it != end; ++it)
+            if (map_.key_eq()(it->first, k)) return it->second;
+        return nullptr;
+    }
+
+    // Batch stage 1: hash every key of a chunk once, then touch each bucket's first node so
+    // the chunk's bucket-array and node misses are in flight together.
+    template<typename KeyAt>
+    void bucket_chunk(KeyAt key_at, size_t cnt, size_t* buckets) const {
+        for (size_t i = 0; i < cnt; ++i) buckets[i] = map_.bucket(key_at(i));
+        for (size_t i = 0; i < cnt; ++i) {
+            auto it = map_.begin(buckets[i]);
+            if (it != map_.end(buckets[i])) prefetch(&*it);
+        }
+    }
+
 public:
-    explicit LRUCache(size_t capacity = 100) : capacity_(capacity), head_(nullptr), tail_(nullptr) {
-        if (capacity_ == 0) capacity_ = 1;
+    explicit LRUCache(size_t capacity = 100) : capacity_(capacity ? capacity : 1), recency_(capacity_) {
         map_.reserve(capacity_ * 2 + 1);
     }
 
@@ -88,57 +221,133 @@ public:
     // Get value if present; moves entry to most-recent position.
     // Returns std::optional<Value> (empty if not found).
     std::optional<Value> get(const Key& k) {
-        auto it = map_.find(k);
-        if (it == map_.end()) return std::nullopt;
-        Node* node = it->second;
-        move_to_front(node);
+        [[maybe_unused]] auto timer = stats_policy().time(CacheOp::Get);
+        Node* node = touch(k);
+        if (!node) return std::nullopt;
+        return node->value;
+    }
+
+    template<typename K, typename = enable_if_heterogeneous<K>>
+    std::optional<Value> get(const K& k) {
+        [[maybe_unused]] auto timer = stats_policy().time(CacheOp::Get);
+        Node* node = touch(k);
+        if (!node) return std::nullopt;
         return node->value;
     }
 
+    // Like get() but without copying: pointer to the cached value (nullptr if absent).
+    // The pointer stays valid until the entry is evicted, erased or the cache is cleared
+    // (updating the same key keeps it valid; inserting other keys may evict it).
+    Value* get_ptr(const Key& k) {
+        [[maybe_unused]] auto timer = stats_policy().time(CacheOp::Get);
+        Node* node = touch(k);
+        return node ? &node->value : nullptr;
+    }
+
+    template<typename K, typename = enable_if_heterogeneous<K>>
+    Value* get_ptr(const K& k) {
+        [[maybe_unused]] auto timer = stats_policy().time(CacheOp::Get);
+        Node* node = touch(k);
+        return node ? &node->value : nullptr;
+    }
+
     // Put (insert or update). Moves/creates entry to most-recent.
     void put(const Key& k, const Value& v) {
-        auto it = map_.find(k);
-        if (it != map_.end()) {
-            // update existing
-            Node* node = it->second;
-            node->value = v;
-            move_to_front(node);
-            return;
+        upsert(k, v);
+    }
+
+    // Put that moves the key (on insert) and value in instead of copying them.
+    void put(Key&& k, Value&& v) {
+        upsert(std::move(k), std::move(v));
+    }
+
+    // Insert: the value is constructed from args directly inside the new node (no temporary).
+    // Update: a Value built from args is move-assigned over the existing one.
+    // Returns a reference to the stored value, valid like get_ptr().
+    template<typename K, typename... Args>
+    Value& emplace(K&& k, Args&&... args) {
+        Node* node = upsert(std::forward<K>(k), std::forward<Args>(args)...);
+        return node->value;
+    }
+
+    // Batched get: same results and recency order as calling get() on each key in turn.
+    // Each chunk is pipelined: hash every key once and prefetch the buckets, walk the
+    // buckets and prefetch the found nodes, then relink and copy out.
+    // Latency histograms (TimedCacheStats) only sample scalar get()/put().
+    void get_many(const Key* keys, size_t n, std::optional<Value>* out) {
+        size_t buckets[BATCH_CHUNK];
+        Node* found[BATCH_CHUNK];
+        for (size_t base = 0; base < n; base += BATCH_CHUNK) {
+            size_t cnt = (n - base < BATCH_CHUNK) ? n - base : BATCH_CHUNK;
+            const Key* chunk = keys + base;
+            bucket_chunk([chunk](size_t i) -> const Key& { return chunk[i]; }, cnt, buckets);
+            for (size_t i = 0; i < cnt; ++i) {
+                found[i] = find_in_bucket(chunk[i], buckets[i]);
+                if (found[i]) prefetch(found[i]);
+            }
+            for (size_t i = 0; i < cnt; ++i) {
+                Node* node = found[i];
+                if (!node) {
+                    stats_policy().record_miss();
+                    out[base + i] = std::nullopt;
+                    continue;
+                }
+                stats_policy().record_hit();
+                recency_.on_hit(node);
+                out[base + i] = node->value;
+            }
         }
-        // insert new
-        Node* node = new Node(k, v);
-        add_to_front(node);
-        map_[k] = node;
+    }
 
-        if (map_.size() > capacity_) {
-            Node* old = pop_tail();
-            if (old) {
-                map_.erase(old->key);
-                delete old;
+    std::vector<std::optional<Value>> get_many(const std::vector<Key>& keys) {
+        std::vector<std::optional<Value>> out(keys.size());
+        get_many(keys.data(), keys.size(), out.data());
+        return out;
+    }
+
+    // Batched put: same final state as calling put() on each item in turn. Keys are hashed
+    // once per chunk (buckets prefetched); each put then looks its key up in the precomputed
+    // bucket. The lookup runs at put time, since an earlier put in the chunk may evict.
+    // Inserting a new key still hashes it inside std::unordered_map::emplace.
+    void put_many(const std::pair<Key, Value>* items, size_t n) {
+        size_t buckets[BATCH_CHUNK];
+        for (size_t base = 0; base < n; base += BATCH_CHUNK) {
+            size_t cnt = (n - base < BATCH_CHUNK) ? n - base : BATCH_CHUNK;
+            const std::pair<Key, Value>* chunk = items + base;
+            bucket_chunk([chunk](size_t i) -> const Key& { return chunk[i].first; }, cnt, buckets);
+            for (size_t i = 0; i < cnt; ++i) {
+                upsert_found(find_in_bucket(chunk[i].first, buckets[i]), chunk[i].first, chunk[i].second);
             }
         }
     }
 
+    void put_many(const std::vector<std::pair<Key, Value>>& items) {
+        put_many(items.data(), items.size());
+    }
+
     // Erase key if exists. Returns true if erased.
-    bool erase(const Key& k) {
-        auto it = map_.find(k);
+    bool erase(const Key& k) { return erase_impl(k); }
+
+    template<typename K, typename = enable_if_heterogeneous<K>>
+    bool erase(const K& k) { return erase_impl(k); }
+
+private:
+    template<typename K>
+    bool erase_impl(const K& k) {
+        auto it = find_it(k);
         if (it == map_.end()) return false;
         Node* node = it->second;
-        remove_node(node);
+        recency_.on_erase(node);
         map_.erase(it);
         delete node;
         return true;
     }
 
+public:
     // Clear all entries
     void clear() {
-        Node* cur = head_;
-        while (cur) {
-            Node* nx = cur->next;
-            delete cur;
-            cur = nx;
-        }
-        head_ = tail_ = nullptr;
+        recency_.clear();   // unlinks the nodes, so it must run before they are deleted
+        for (auto& kv : map_) delete kv.second;
         map_.clear();
     }
 
@@ -148,19 +357,31 @@ public:
     // Capacity
     size_t capacity() const { return capacity_; }
 
+    // Counter snapshot (safe to call from another thread while the cache is in use)
+    CacheStatsSnapshot stats() const { return stats_policy().snapshot(); }
+    void reset_stats() { stats_policy().reset(); }
+
+    // Visit entries from most->least recent without touching recency.
+    template<typename F>
+    void for_each(F&& f) const {
+        recency_.for_each([&f](const Node& n) { f(n.key, n.value); });
+    }
+
     // Debug helper: print keys from most->least recent
     void debug_print(std::ostream& os = std::cout) const {
         os << "LRU (most->least): [";
-        Node* cur = head_;
         bool first = true;
-        while (cur) {
+        recency_.for_each([&](const Node& n) {
             if (!first) os << " , ";
-            os << cur->key;
+            os << n.key;
             first = false;
-            cur = cur->next;
-        }
+        });
         os << "]\n";
     }
 };
 
+// LRU cache keyed by std::string that can be queried with std::string_view / const char*.
+template<typename Value, typename Stats = NoCacheStats>
+using StringLRUCache = LRUCache<std::string, Value, Stats, TransparentStringHash, std::equal_to<>>;
+
 #endif // LRU_CACHE_H
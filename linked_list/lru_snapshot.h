@@ -0,0 +1,285 @@
+#ifndef LRU_SNAPSHOT_H
+#define LRU_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define LRU_SNAPSHOT_HAS_MMAP 1
+#define LRU_SNAPSHOT_HAS_FSYNC 1
+#endif
+
+/*
+  lru_snapshot.h
+  - Persist and warm-start an LRUCache (or any cache exposing key_type, mapped_type,
+    capacity(), for_each(f) from most->least recent, and put(k, v))
+  - Each key and value is encoded by lru_snapshot_codec<T>:
+      trivially copyable T    raw sizeof(T) bytes (decoding is a memcpy)
+      std::basic_string       uint64 length in characters, then the characters
+    Specialize lru_snapshot_codec for other types (same four members as below).
+  - Key and Value must be default constructible: records are decoded into
+    default-constructed objects and then put() into the cache.
+  - File layout (native endianness, not portable across architectures):
+      LRUSnapshotHeader       key_size / value_size = fixed record size, 0 = length-prefixed
+      count records of [key][value], most recent first
+  - Functions:
+      bool save_lru_snapshot(const Cache& c, const std::string& path)
+          writes path + ".tmp", fsyncs it, renames it over path and fsyncs the directory
+          (POSIX), so after a crash path holds the old or the new snapshot, never a torn
+          one. Elsewhere the rename is still atomic but durability is left to the OS.
+      bool load_lru_snapshot(Cache& c, const std::string& path, size_t* loaded = nullptr)
+          maps the file with mmap (plain read elsewhere) and inserts the most recent
+          min(count, capacity) entries so that their recency order is preserved
+      Both return false on I/O errors, a truncated file, or a header that does not match
+      the cache's types.
+*/
+
+struct LRUSnapshotHeader {
+    char magic[8];            // "LRUSNAP\0"
+    std::uint32_t version;
+    std::uint32_t key_size;
+    std::uint32_t value_size;
+    std::uint32_t reserved;
+    std::uint64_t count;
+};
+
+// Encoding of one key or value. fixed_size is the encoded size, or 0 when it varies;
+// measure() checks that a whole encoded object fits in the avail bytes at p and sets len.
+template<typename T, typename Enable = void>
+struct lru_snapshot_codec {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "lru_snapshot_codec: specialize it for types that are not trivially copyable");
+
+    static constexpr std::uint32_t fixed_size = sizeof(T);
+
+    static bool write(std::FILE *f, const T &v) { return std::fwrite(&v, sizeof(T), 1, f) == 1; }
+
+    static bool measure(const unsigned char*, std::size_t avail, std::size_t &len) {
+        len = sizeof(T);
+        return avail >= sizeof(T);
+    }
+
+    static void read(const unsigned char *p, T &out) { std::memcpy(&out, p, sizeof(T)); }
+};
+
+template<typename CharT, typename Traits, typename Alloc>
+struct lru_snapshot_codec<std::basic_string<CharT, Traits, Alloc>,
+                          typename std::enable_if<std::is_trivially_copyable<CharT>::value>::type> {
+    using String = std::basic_string<CharT, Traits, Alloc>;
+
+    static constexpr std::uint32_t fixed_size = 0;
+
+    static bool write(std::FILE *f, const String &s) {
+        std::uint64_t n = s.size();
+        if (std::fwrite(&n, sizeof(n), 1, f) != 1) return false;
+        return n == 0 || std::fwrite(s.data(), sizeof(CharT), s.size(), f) == s.size();
+    }
+
+    static bool measure(const unsigned char *p, std::size_t avail, std::size_t &len) {
+        std::uint64_t n;
+        if (avail < sizeof(n)) return false;
+        std::memcpy(&n, p, sizeof(n));
+        if (n > (avail - sizeof(n)) / sizeof(CharT)) return false;
+        len = sizeof(n) + static_cast<std::size_t>(n) * sizeof(CharT);
+        return true;
+    }
+
+    static void read(const unsigned char *p, String &out) {
+        std::uint64_t n;
+        std::memcpy(&n, p, sizeof(n));
+        out.resize(static_cast<std::size_t>(n));
+        if (n) std::memcpy(&out[0], p + sizeof(n), static_cast<std::size_t>(n) * sizeof(CharT));
+    }
+};
+
+namespace lru_snapshot_detail {
+
+    inline constexpr char MAGIC[8] = {'L', 'R', 'U', 'S', 'N', 'A', 'P', '\0'};
+    inline constexpr std::uint32_t VERSION = 1;
+
+    // Flush f's buffers all the way to the disk (a no-op where fsync is unavailable)
+    inline bool sync_file(std::FILE *f) {
+        if (std::fflush(f) != 0) return false;
+#ifdef LRU_SNAPSHOT_HAS_FSYNC
+        return ::fsync(::fileno(f)) == 0;
+#else
+        return true;
+#endif
+    }
+
+    // Persist the directory entry created by a rename. Best effort: some file systems
+    // refuse fsync on directories, and the new file is already in place by then.
+    inline void sync_parent_dir(const std::string &path) {
+#ifdef LRU_SNAPSHOT_HAS_FSYNC
+        std::string::size_type slash = path.find_last_of('/');
+        std::string dir = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+        int fd = ::open(dir.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        ::fsync(fd);
+        ::close(fd);
+#else
+        (void)path;
+#endif
+    }
+
+    // Read-only view of a whole file: mmap where available, a heap copy otherwise.
+    class FileView {
+    private:
+        const unsigned char *data_;
+        std::size_t size_;
+#ifdef LRU_SNAPSHOT_HAS_MMAP
+        void *map_;
+#endif
+        std::vector<unsigned char> copy_;
+
+    public:
+        explicit FileView(const std::string &path) : data_(nullptr), size_(0) {
+#ifdef LRU_SNAPSHOT_HAS_MMAP
+            map_ = nullptr;
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) return;
+            struct stat st;
+            if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+                void *p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    map_ = p;
+                    size_ = static_cast<std::size_t>(st.st_size);
+                    data_ = static_cast<const unsigned char*>(p);
+#ifdef MADV_SEQUENTIAL
+                    ::madvise(p, size_, MADV_SEQUENTIAL);
+#endif
+                }
+            }
+            ::close(fd);
+#else
+            std::ifstream in(path, std::ios::binary);
+            if (!in) return;
+            copy_.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+            data_ = copy_.data();
+            size_ = copy_.size();
+#endif
+        }
+
+        ~FileView() {
+#ifdef LRU_SNAPSHOT_HAS_MMAP
+            if (map_) ::munmap(map_, size_);
+#endif
+        }
+
+        FileView(const FileView&) = delete;
+        FileView& operator=(const FileView&) = delete;
+
+        const unsigned char* data() const { return data_; }
+        std::size_t size() const { return size_; }
+    };
+
+} // namespace lru_snapshot_detail
+
+template<typename Cache>
+bool save_lru_snapshot(const Cache &cache, const std::string &path) {
+    using Key = typename Cache::key_type;
+    using Value = typename Cache::mapped_type;
+    using KeyCodec = lru_snapshot_codec<Key>;
+    using ValueCodec = lru_snapshot_codec<Value>;
+
+    const std::string tmp = path + ".tmp";
+    std::FILE *f = std::fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+
+    LRUSnapshotHeader h;
+    std::memcpy(h.magic, lru_snapshot_detail::MAGIC, sizeof(h.magic));
+    h.version = lru_snapshot_detail::VERSION;
+    h.key_size = KeyCodec::fixed_size;
+    h.value_size = ValueCodec::fixed_size;
+    h.reserved = 0;
+    h.count = 0;
+
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1;
+    cache.for_each([&](const Key &k, const Value &v) {
+        if (!ok) return;
+        ok = KeyCodec::write(f, k) && ValueCodec::write(f, v);
+        ++h.count;
+    });
+    // patch the record count now that it is known, then make the data durable before
+    // the rename can expose it
+    if (ok) ok = std::fseek(f, 0, SEEK_SET) == 0 && std::fwrite(&h, sizeof(h), 1, f) == 1;
+    if (ok) ok = lru_snapshot_detail::sync_file(f);
+    if (std::fclose(f) != 0) ok = false;
+    if (!ok || std::rename(tmp.c_str(), path.c_str()) != 0) {
+        std::remove(tmp.c_str());
+        return false;
+    }
+    lru_snapshot_detail::sync_parent_dir(path);
+    return true;
+}
+
+template<typename Cache>
+bool load_lru_snapshot(Cache &cache, const std::string &path, std::size_t *loaded = nullptr) {
+    using Key = typename Cache::key_type;
+    using Value = typename Cache::mapped_type;
+    using KeyCodec = lru_snapshot_codec<Key>;
+    using ValueCodec = lru_snapshot_codec<Value>;
+    static_assert(std::is_default_constructible<Key>::value && std::is_default_constructible<Value>::value,
+                  "load_lru_snapshot: records are decoded into default-constructed keys and values");
+    if (loaded) *loaded = 0;
+
+    lru_snapshot_detail::FileView file(path);
+    if (!file.data() || file.size() < sizeof(LRUSnapshotHeader)) return false;
+
+    LRUSnapshotHeader h;
+    std::memcpy(&h, file.data(), sizeof(h));
+    if (std::memcmp(h.magic, lru_snapshot_detail::MAGIC, sizeof(h.magic)) != 0 ||
+        h.version != lru_snapshot_detail::VERSION ||
+        h.key_size != KeyCodec::fixed_size || h.value_size != ValueCodec::fixed_size) return false;
+
+    std::size_t n = static_cast<std::size_t>(h.count);
+    if (n > cache.capacity()) n = cache.capacity();
+
+    // Records are most recent first; insert the newest `n` oldest-first so the final
+    // recency order matches the saved cache. Fixed-size records are indexed directly,
+    // length-prefixed ones are located (and bounds-checked) in one forward pass.
+    const unsigned char *base = file.data() + sizeof(h);
+    const std::size_t avail = file.size() - sizeof(h);
+    std::vector<const unsigned char*> starts;
+    if (KeyCodec::fixed_size && ValueCodec::fixed_size) {
+        const std::size_t rec = std::size_t(KeyCodec::fixed_size) + ValueCodec::fixed_size;
+        if (avail / rec < h.count) return false; // truncated file
+    } else {
+        starts.reserve(n);
+        std::size_t off = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t klen, vlen;
+            if (!KeyCodec::measure(base + off, avail - off, klen) ||
+                !ValueCodec::measure(base + off + klen, avail - off - klen, vlen)) return false;
+            starts.push_back(base + off);
+            off += klen + vlen;
+        }
+    }
+
+    for (std::size_t i = n; i-- > 0;) {
+        const unsigned char *p = starts.empty()
+            ? base + i * (std::size_t(KeyCodec::fixed_size) + ValueCodec::fixed_size)
+            : starts[i];
+        std::size_t klen = KeyCodec::fixed_size;
+        if (!klen) KeyCodec::measure(p, avail - static_cast<std::size_t>(p - base), klen);
+        Key k;
+        Value v;
+        KeyCodec::read(p, k);
+        ValueCodec::read(p + klen, v);
+        cache.put(k, v);
+    }
+    if (loaded) *loaded = n;
+    return true;
+}
+
+#endif // LRU_SNAPSHOT_H
@@ -0,0 +1,147 @@
+#ifndef POLICY_CACHE_H
+#define POLICY_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include "eviction_policies.h"
+
+/*
+  policy_cache.h
+  - Cache with a pluggable eviction policy: PolicyCache<Key, Value, Policy, Hash>
+  - Same get/put/erase/clear interface as LRUCache; the policy (eviction_policies.h)
+    decides which entry leaves when the cache is over capacity.
+  - Aliases:
+      LRUPolicyCache<K, V>  — same eviction order as LRUCache
+      ClockCache<K, V>      — CLOCK, hits only set a reference bit
+      SLRUCache<K, V>       — segmented LRU, resists one-off scans
+      TinyLFUCache<K, V>    — W-TinyLFU admission with a count-min sketch
+  - Methods:
+      PolicyCache(size_t capacity)
+      std::optional<Value> get(const Key& k)
+      void put(const Key& k, const Value& v)
+      bool erase(const Key& k)
+      void clear()
+      size_t size() const / size_t capacity() const
+*/
+
+template<typename Key, typename Value,
+         template<typename> class Policy = cachepolicy::LRUPolicy,
+         typename Hash = std::hash<Key>>
+class PolicyCache {
+private:
+    struct Entry {
+        Key key;
+        Value value;
+        std::size_t hash;
+        typename cachepolicy::policy_hook<Policy, Entry>::type hook;
+        Entry(const Key& k, const Value& v, std::size_t h) : key(k), value(v), hash(h), hook() {}
+    };
+
+    using PolicyType = Policy<Entry>;
+
+    std::size_t capacity_;
+    std::unordered_map<Key, Entry*, Hash> map_;
+    PolicyType policy_;
+    Hash hasher_;
+
+    // spread std::hash output (identity for integers) before the policy uses it
+    std::size_t hash_of(const Key& k) const {
+        std::uint64_t x = static_cast<std::uint64_t>(hasher_(k));
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        return static_cast<std::size_t>(x);
+    }
+
+public:
+    explicit PolicyCache(std::size_t capacity = 100)
+        : capacity_(capacity ? capacity : 1), policy_(capacity_) {
+        map_.reserve(capacity_ * 2 + 1);
+    }
+
+    ~PolicyCache() { clear(); }
+
+    // non-copyable (pointer ownership)
+    PolicyCache(const PolicyCache&) = delete;
+    PolicyCache& operator=(const PolicyCache&) = delete;
+
+    // Get value if present and tell the policy about the hit (or miss).
+    std::optional<Value> get(const Key& k) {
+        auto it = map_.find(k);
+        if (it == map_.end()) {
+            policy_.on_miss(hash_of(k));
+            return std::nullopt;
+        }
+        Entry* e = it->second;
+        policy_.on_hit(e);
+        return e->value;
+    }
+
+    // Put (insert or update). A new key may be rejected by admission policies,
+    // in which case it is dropped again immediately.
+    void put(const Key& k, const Value& v) {
+        auto it = map_.find(k);
+        if (it != map_.end()) {
+            Entry* e = it->second;
+            e->value = v;
+            policy_.on_hit(e);
+            return;
+        }
+        Entry* e = new Entry(k, v, hash_of(k));
+        map_.emplace(k, e);
+        policy_.on_insert(e);
+
+        if (map_.size() > capacity_) {
+            Entry* victim = policy_.evict();
+            if (victim) {
+                map_.erase(victim->key);
+                delete victim;
+            }
+        }
+    }
+
+    // Erase key if exists. Returns true if erased.
+    bool erase(const Key& k) {
+        auto it = map_.find(k);
+        if (it == map_.end()) return false;
+        Entry* e = it->second;
+        policy_.on_erase(e);
+        map_.erase(it);
+        delete e;
+        return true;
+    }
+
+    // Clear all entries
+    void clear() {
+        policy_.clear();   // unlinks entries, so it must run before they are deleted
+        for (auto &kv : map_) delete kv.second;
+        map_.clear();
+    }
+
+    // Whether k is cached (does not count as an access)
+    bool contains(const Key& k) const { return map_.find(k) != map_.end(); }
+
+    // Number of stored entries
+    std::size_t size() const { return map_.size(); }
+
+    // Capacity
+    std::size_t capacity() const { return capacity_; }
+};
+
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+using LRUPolicyCache = PolicyCache<Key, Value, cachepolicy::LRUPolicy, Hash>;
+
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+using ClockCache = PolicyCache<Key, Value, cachepolicy::ClockPolicy, Hash>;
+
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+using SLRUCache = PolicyCache<Key, Value, cachepolicy::SLRUPolicy, Hash>;
+
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+using TinyLFUCache = PolicyCache<Key, Value, cachepolicy::WTinyLFUPolicy, Hash>;
+
+#endif // POLICY_CACHE_H
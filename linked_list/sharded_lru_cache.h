@@ -0,0 +1,157 @@
+#ifndef SHARDED_LRU_CACHE_H
+#define SHARDED_LRU_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "lru_cache.h"
+#include "cache_stats.h"
+#include "../common/bit_utils.h"
+
+/*
+  sharded_lru_cache.h
+  - Thread-safe LRU cache: ShardedLRUCache<Key, Value, Stats = NoCacheStats, Hash, KeyEqual>
+    (same parameters as LRUCache; Hash both picks the shard and is passed to each shard)
+  - Keys are spread over N independent LRUCache shards, each guarded by its own mutex,
+    so threads touching different shards never contend.
+  - Recency is tracked per shard (approximate global LRU); each shard holds
+    ceil(capacity / shard_count) entries.
+  - Methods:
+      ShardedLRUCache(size_t capacity, size_t shard_count = 0)   // 0 -> pick from hardware threads
+      std::optional<Value> get(const Key& k)
+      void put(const Key& k, const Value& v)
+      void put(Key&& k, Value&& v)
+      bool erase(const Key& k)
+      void clear()
+      size_t size() const                          // sums shard sizes (locks every shard)
+      size_t capacity() const
+      size_t shard_count() const
+      CacheStatsSnapshot stats() const             // sum of per-shard counters (lock-free read)
+*/
+
+template<typename Key, typename Value, typename Stats = NoCacheStats,
+         typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class ShardedLRUCache {
+private:
+    // Each shard sits on its own cache line(s) so neighbouring locks don't false-share.
+    struct alignas(64) Shard {
+        mutable std::mutex mtx;
+        LRUCache<Key, Value, Stats, Hash, KeyEqual> cache;
+        explicit Shard(std::size_t cap) : cache(cap) {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::size_t mask_;      // shard_count - 1 (shard count is a power of two)
+    std::size_t capacity_;
+    Hash hasher_;
+
+    // std::hash is the identity for integers on common standard libraries, so mix the
+    // bits before picking a shard (finalizer from MurmurHash3 / splitmix64).
+    static std::size_t mix(std::size_t h) {
+        std::uint64_t x = static_cast<std::uint64_t>(h);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return static_cast<std::size_t>(x);
+    }
+
+    Shard& shard_for(const Key& k) const {
+        return *shards_[mix(hasher_(k)) & mask_];
+    }
+
+public:
+    explicit ShardedLRUCache(std::size_t capacity = 1024, std::size_t shard_count = 0)
+        : capacity_(capacity ? capacity : 1) {
+        if (shard_count == 0) {
+            std::size_t hw = std::thread::hardware_concurrency();
+            shard_count = (hw ? hw : 4) * 4;
+        }
+        shard_count = bitutil::next_pow2(shard_count);
+        // never create more shards than entries, or tiny caches would hold nothing per shard
+        while (shard_count > 1 && shard_count > capacity_) shard_count >>= 1;
+        mask_ = shard_count - 1;
+
+        std::size_t per_shard = (capacity_ + shard_count - 1) / shard_count;
+        shards_.reserve(shard_count);
+        for (std::size_t i = 0; i < shard_count; ++i) shards_.push_back(std::make_unique<Shard>(per_shard));
+    }
+
+    // non-copyable (owns mutexes)
+    ShardedLRUCache(const ShardedLRUCache&) = delete;
+    ShardedLRUCache& operator=(const ShardedLRUCache&) = delete;
+
+    // Get value if present; moves entry to most-recent position within its shard.
+    std::optional<Value> get(const Key& k) {
+        Shard& s = shard_for(k);
+        std::lock_guard<std::mutex> lock(s.mtx);
+        return s.cache.get(k);
+    }
+
+    // Put (insert or update). May evict the least recent entry of the key's shard.
+    void put(const Key& k, const Value& v) {
+        Shard& s = shard_for(k);
+        std::lock_guard<std::mutex> lock(s.mtx);
+        s.cache.put(k, v);
+    }
+
+    // Moving put: the key is hashed before it is handed over.
+    void put(Key&& k, Value&& v) {
+        Shard& s = shard_for(k);
+        std::lock_guard<std::mutex> lock(s.mtx);
+        s.cache.put(std::move(k), std::move(v));
+    }
+
+    // Erase key if exists. Returns true if erased.
+    bool erase(const Key& k) {
+        Shard& s = shard_for(k);
+        std::lock_guard<std::mutex> lock(s.mtx);
+        return s.cache.erase(k);
+    }
+
+    // Clear all shards (each shard is locked in turn, not atomically as a whole)
+    void clear() {
+        for (auto &s : shards_) {
+            std::lock_guard<std::mutex> lock(s->mtx);
+            s->cache.clear();
+        }
+    }
+
+    // Number of stored entries (a snapshot; may be stale under concurrent writes)
+    std::size_t size() const {
+        std::size_t total = 0;
+        for (const auto &s : shards_) {
+            std::lock_guard<std::mutex> lock(s->mtx);
+            total += s->cache.size();
+        }
+        return total;
+    }
+
+    // Requested capacity (actual capacity is shard_count * per-shard capacity)
+    std::size_t capacity() const { return capacity_; }
+
+    std::size_t shard_count() const { return shards_.size(); }
+
+    // Aggregated statistics; each shard keeps its own counters so the hot path never shares them.
+    CacheStatsSnapshot stats() const {
+        CacheStatsSnapshot total;
+        for (const auto &s : shards_) total += s->cache.stats();
+        return total;
+    }
+
+    void reset_stats() {
+        for (auto &s : shards_) {
+            std::lock_guard<std::mutex> lock(s->mtx);
+            s->cache.reset_stats();
+        }
+    }
+};
+
+#endif // SHARDED_LRU_CACHE_H
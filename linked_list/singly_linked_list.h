@@ -5,11 +5,14 @@
 #include <iostream>
 #include <initializer_list>
 #include <utility>
+#include <memory>
+#include "../allocators/node_alloc.h"
 
 // Simple generic singly-linked list implementation.
 // - Node<T> struct
 // - SinglyLinkedList<T> class with insert (head/tail/pos), erase (pos/value), search,
 //   reverse (iterative/recursive), size(), clear(), iterate helpers.
+// Nodes come from Alloc (rebound to SLLNode<T>); std::allocator by default, see allocators/.
 // Note: This header is lightweight and self-contained; keep algorithms that operate on Node<T>
 // in linked_list_algorithms.h for separation of concerns (but some helpers included here).
 
@@ -20,7 +23,7 @@ struct SLLNode {
     SLLNode(const T &v) : val(v), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>>
 class SinglyLinkedList {
 public:
     using Node = SLLNode<T>;
@@ -30,9 +33,13 @@ private:
     Node *tail;
     std::size_t len;
 
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    NodeAlloc alloc;
+
 public:
-    SinglyLinkedList(): head(nullptr), tail(nullptr), len(0) {}
-    SinglyLinkedList(std::initializer_list<T> il): head(nullptr), tail(nullptr), len(0) {
+    SinglyLinkedList(): head(nullptr), tail(nullptr), len(0), alloc() {}
+    explicit SinglyLinkedList(const Alloc &a): head(nullptr), tail(nullptr), len(0), alloc(a) {}
+    SinglyLinkedList(std::initializer_list<T> il, const Alloc &a = Alloc()): head(nullptr), tail(nullptr), len(0), alloc(a) {
         for (const T &v : il) push_back(v);
     }
 
@@ -41,13 +48,14 @@ public:
     SinglyLinkedList& operator=(const SinglyLinkedList &) = delete;
 
     // Move constructor
-    SinglyLinkedList(SinglyLinkedList &&other) noexcept {
+    SinglyLinkedList(SinglyLinkedList &&other) noexcept : alloc(std::move(other.alloc)) {
         head = other.head; tail = other.tail; len = other.len;
         other.head = other.tail = nullptr; other.len = 0;
     }
     SinglyLinkedList& operator=(SinglyLinkedList &&other) noexcept {
         if (this != &other) {
             clear();
+            alloc = std::move(other.alloc);
             head = other.head; tail = other.tail; len = other.len;
             other.head = other.tail = nullptr; other.len = 0;
         }
@@ -62,9 +70,16 @@ public:
     Node* get_head() const { return head; }
     Node* get_tail() const { return tail; }
 
+    // Algorithms that relink the existing nodes in place (e.g. llist::mergesort_list)
+    // report the new ends here; the node count is unchanged.
+    void set_links(Node *new_head, Node *new_tail) {
+        head = new_head;
+        tail = new_tail;
+    }
+
     // Insert at head
     void push_front(const T &v) {
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         n->next = head;
         head = n;
         if (!tail) tail = n;
@@ -73,7 +88,7 @@ public:
 
     // Append at tail
     void push_back(const T &v) {
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         if (!tail) {
             head = tail = n;
         } else {
@@ -91,7 +106,7 @@ public:
         if (pos == len) { push_back(v); return true; }
         Node *cur = head;
         for (std::size_t i = 0; i + 1 < pos; ++i) cur = cur->next;
-        Node *n = new Node(v);
+        Node *n = nodealloc::create_node(alloc, v);
         n->next = cur->next;
         cur->next = n;
         ++len;
@@ -104,7 +119,7 @@ public:
         if (pos == 0) {
             Node *tmp = head;
             head = head->next;
-            delete tmp;
+            nodealloc::destroy_node(alloc, tmp);
             if (!head) tail = nullptr;
             --len;
             return true;
@@ -114,7 +129,7 @@ public:
         Node *target = cur->next;
         cur->next = target->next;
         if (target == tail) tail = cur;
-        delete target;
+        nodealloc::destroy_node(alloc, target);
         --len;
         return true;
     }
@@ -133,7 +148,7 @@ public:
                     prev->next = cur->next;
                     if (cur == tail) tail = prev;
                 }
-                delete cur;
+                nodealloc::destroy_node(alloc, cur);
                 --len;
                 return true;
             }
@@ -159,7 +174,7 @@ public:
         Node *cur = head;
         while (cur) {
             Node *nx = cur->next;
-            delete cur;
+            nodealloc::destroy_node(alloc, cur);
             cur = nx;
         }
         head = tail = nullptr;
@@ -234,7 +249,7 @@ public:
         slow->next = to_delete->next;
         if (to_delete == tail) tail = slow == &dummy ? nullptr : slow;
         if (to_delete == head) head = to_delete->next;
-        delete to_delete;
+        nodealloc::destroy_node(alloc, to_delete);
         --len;
         // if head changed from dummy.next, update head pointer
         head = dummy.next;
@@ -257,7 +272,7 @@ public:
     // After merge, other becomes empty. Returns pointer to new head.
     // This operation is O(n) and reuses nodes (no allocation).
     void merge_sorted_inplace(SinglyLinkedList &other) {
-        Node dummy(T());
+        Node dummy{T()};
         Node *tailptr = &dummy;
         Node *a = this->head;
         Node *b = other.head;
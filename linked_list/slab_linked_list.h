@@ -0,0 +1,339 @@
+#ifndef SLAB_LINKED_LIST_H
+#define SLAB_LINKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+  slab_linked_list.h
+  - Singly linked list whose nodes live in one contiguous, growable slab:
+      SlabLinkedList<T, Alloc = std::allocator<T>>
+  - Links are 32-bit slab indices (NIL = 0xFFFFFFFF) instead of 8-byte pointers, and
+    nodes allocated together sit next to each other in memory.
+  - Erased nodes go on an intrusive free list threaded through their `next` field and
+    are reused by later inserts; the slab never shrinks except on clear()/compact().
+    A node's value is destroyed when it is erased (free slots hold raw storage), so T
+    needs no default constructor or assignment.
+  - Indices stay valid until the element is erased or compact()/clear() is called;
+    slab growth may move nodes, so references into the slab do not survive inserts.
+  - Same API as SinglyLinkedList, with indices in place of Node*; the llist:: algorithms
+    in linked_list_algorithms.h have overloads for it.
+  - Methods:
+      push_front(v) / push_back(v)                 O(1) amortized
+      bool insert_at(pos, v) / bool erase_at(pos)  O(n)
+      bool remove_value(v)                         O(n)
+      index_type find(v) const                     O(n), NIL if absent
+      Node& node(i) / T& value(i) / index_type next(i)
+      index_type get_head() const / get_tail() const
+      void set_links(head, tail)                   for algorithms that relink nodes in place
+      void reserve(n) / size_t capacity() const
+      void compact()                               relayout nodes in list order, drop free slots
+      size() / empty() / clear() / print()
+*/
+
+template<typename T, typename Alloc = std::allocator<T>>
+class SlabLinkedList {
+public:
+    using index_type = std::uint32_t;
+    static constexpr index_type NIL = 0xFFFFFFFFu;
+
+    // val is constructed only while the node is in the list; a free slot holds no T.
+    struct Node {
+        union { T val; };
+        index_type next;
+        Node() : next(NIL) {}
+        ~Node() {}
+        Node(const Node &) = delete;
+        Node& operator=(const Node &) = delete;
+    };
+
+private:
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+    Node *slab;             // slots [0, used) have been handed out; every live one is in the list
+    std::size_t used;
+    std::size_t cap;
+    index_type head;
+    index_type tail;
+    index_type free_head;   // free list threaded through Node::next
+    std::size_t len;
+    NodeAlloc alloc;
+
+    // Destroy every live value (walks the list; free slots hold nothing)
+    void destroy_values() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (index_type cur = head; cur != NIL; cur = slab[cur].next) slab[cur].val.~T();
+        }
+    }
+
+    void release_slab() {
+        if (!slab) return;
+        destroy_values();
+        NodeTraits::deallocate(alloc, slab, cap);
+    }
+
+    // Move to a buffer of new_cap slots, keeping every index. If moving a value throws,
+    // the new buffer is released and the list is untouched.
+    void regrow(std::size_t new_cap) {
+        Node *nb = NodeTraits::allocate(alloc, new_cap);
+        for (std::size_t i = 0; i < used; ++i) {
+            ::new (static_cast<void*>(nb + i)) Node();
+            nb[i].next = slab[i].next;
+        }
+        index_type cur = head;
+        try {
+            for (; cur != NIL; cur = slab[cur].next)
+                ::new (static_cast<void*>(&nb[cur].val)) T(std::move_if_noexcept(slab[cur].val));
+        } catch (...) {
+            for (index_type d = head; d != cur; d = slab[d].next) nb[d].val.~T();
+            NodeTraits::deallocate(alloc, nb, new_cap);
+            throw;
+        }
+        release_slab();
+        slab = nb;
+        cap = new_cap;
+    }
+
+    // Take a slot from the free list or a new one at the end; returns its index.
+    // Nothing changes if constructing the value throws.
+    template<typename V>
+    index_type acquire(V &&v, index_type nx) {
+        index_type i;
+        if (free_head != NIL) {
+            i = free_head;
+            ::new (static_cast<void*>(&slab[i].val)) T(std::forward<V>(v));
+            free_head = slab[i].next;
+        } else {
+            if (used >= NIL) throw std::length_error("SlabLinkedList: index space exhausted");
+            if (used == cap) regrow(cap ? cap * 2 : 4);
+            i = static_cast<index_type>(used);
+            ::new (static_cast<void*>(slab + i)) Node();
+            ::new (static_cast<void*>(&slab[i].val)) T(std::forward<V>(v));
+            ++used;
+        }
+        slab[i].next = nx;
+        return i;
+    }
+
+    // Destroy the slot's value and put the slot on the free list.
+    void release(index_type i) {
+        slab[i].val.~T();
+        slab[i].next = free_head;
+        free_head = i;
+    }
+
+    template<typename V>
+    void push_front_impl(V &&v) {
+        index_type i = acquire(std::forward<V>(v), head);
+        head = i;
+        if (tail == NIL) tail = i;
+        ++len;
+    }
+
+    template<typename V>
+    void push_back_impl(V &&v) {
+        index_type i = acquire(std::forward<V>(v), NIL);
+        if (tail == NIL) head = i;
+        else slab[tail].next = i;
+        tail = i;
+        ++len;
+    }
+
+    void reset_empty() {
+        slab = nullptr;
+        used = cap = 0;
+        head = tail = free_head = NIL;
+        len = 0;
+    }
+
+public:
+    SlabLinkedList() : alloc() { reset_empty(); }
+    explicit SlabLinkedList(const Alloc &a) : alloc(a) { reset_empty(); }
+    SlabLinkedList(std::initializer_list<T> il, const Alloc &a = Alloc()) : alloc(a) {
+        reset_empty();
+        reserve(il.size());
+        for (const T &v : il) push_back(v);
+    }
+
+    ~SlabLinkedList() { release_slab(); }
+
+    // Copying the slab would be cheap but is disabled for consistency with the other lists.
+    SlabLinkedList(const SlabLinkedList &) = delete;
+    SlabLinkedList& operator=(const SlabLinkedList &) = delete;
+
+    SlabLinkedList(SlabLinkedList &&other) noexcept
+        : slab(other.slab), used(other.used), cap(other.cap), head(other.head), tail(other.tail),
+          free_head(other.free_head), len(other.len), alloc(std::move(other.alloc)) {
+        other.reset_empty();
+    }
+    SlabLinkedList& operator=(SlabLinkedList &&other) noexcept {
+        if (this != &other) {
+            release_slab();
+            alloc = std::move(other.alloc);
+            slab = other.slab; used = other.used; cap = other.cap;
+            head = other.head; tail = other.tail; free_head = other.free_head; len = other.len;
+            other.reset_empty();
+        }
+        return *this;
+    }
+
+    // Basic queries
+    bool empty() const { return len == 0; }
+    std::size_t size() const { return len; }
+    std::size_t capacity() const { return cap; }
+    index_type get_head() const { return head; }
+    index_type get_tail() const { return tail; }
+
+    // Node access by index (index must refer to a live node)
+    Node& node(index_type i) { return slab[i]; }
+    const Node& node(index_type i) const { return slab[i]; }
+    T& value(index_type i) { return slab[i].val; }
+    const T& value(index_type i) const { return slab[i].val; }
+    index_type next(index_type i) const { return slab[i].next; }
+
+    // Algorithms that relink nodes in place report the new ends here.
+    void set_links(index_type new_head, index_type new_tail) {
+        head = new_head;
+        tail = new_tail;
+    }
+
+    void reserve(std::size_t n) {
+        if (n > cap) regrow(n);
+    }
+
+    // Insert at head
+    void push_front(const T &v) { push_front_impl(v); }
+    void push_front(T &&v) { push_front_impl(std::move(v)); }
+
+    // Append at tail
+    void push_back(const T &v) { push_back_impl(v); }
+    void push_back(T &&v) { push_back_impl(std::move(v)); }
+
+    // Insert at 0-based position pos (0 == head, pos == size -> push_back)
+    // Returns true if inserted, false if pos > size
+    bool insert_at(std::size_t pos, const T &v) {
+        if (pos == 0) { push_front(v); return true; }
+        if (pos > len) return false;
+        if (pos == len) { push_back(v); return true; }
+        index_type cur = head;
+        for (std::size_t i = 0; i + 1 < pos; ++i) cur = slab[cur].next;
+        index_type n = acquire(v, slab[cur].next);
+        slab[cur].next = n;
+        ++len;
+        return true;
+    }
+
+    // Erase node at position pos (0-based). Returns true if erased.
+    bool erase_at(std::size_t pos) {
+        if (pos >= len) return false;
+        if (pos == 0) {
+            index_type old = head;
+            head = slab[old].next;
+            if (head == NIL) tail = NIL;
+            release(old);
+            --len;
+            return true;
+        }
+        index_type cur = head;
+        for (std::size_t i = 0; i + 1 < pos; ++i) cur = slab[cur].next;
+        index_type target = slab[cur].next;
+        slab[cur].next = slab[target].next;
+        if (target == tail) tail = cur;
+        release(target);
+        --len;
+        return true;
+    }
+
+    // Remove first occurrence of value v (returns true if removed)
+    bool remove_value(const T &v) {
+        index_type prev = NIL;
+        for (index_type cur = head; cur != NIL; prev = cur, cur = slab[cur].next) {
+            if (slab[cur].val == v) {
+                if (prev == NIL) head = slab[cur].next;
+                else slab[prev].next = slab[cur].next;
+                if (cur == tail) tail = prev;
+                release(cur);
+                --len;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Linear search (returns index of node or NIL)
+    index_type find(const T &v) const {
+        for (index_type cur = head; cur != NIL; cur = slab[cur].next)
+            if (slab[cur].val == v) return cur;
+        return NIL;
+    }
+
+    // Reverse iteratively - modifies list in-place
+    void reverse_iterative() {
+        index_type prev = NIL;
+        index_type cur = head;
+        tail = head;
+        while (cur != NIL) {
+            index_type nx = slab[cur].next;
+            slab[cur].next = prev;
+            prev = cur;
+            cur = nx;
+        }
+        head = prev;
+    }
+
+    // Rebuild the slab in list order: traversal becomes a linear scan and free slots go away.
+    // Invalidates all indices.
+    void compact() {
+        Node *fresh = len ? NodeTraits::allocate(alloc, len) : nullptr;
+        std::size_t n = 0;
+        try {
+            for (index_type cur = head; cur != NIL; cur = slab[cur].next, ++n) {
+                ::new (static_cast<void*>(fresh + n)) Node();
+                ::new (static_cast<void*>(&fresh[n].val)) T(std::move_if_noexcept(slab[cur].val));
+                fresh[n].next = static_cast<index_type>(n + 1);
+            }
+        } catch (...) {
+            while (n > 0) fresh[--n].val.~T();
+            NodeTraits::deallocate(alloc, fresh, len);
+            throw;
+        }
+        if (n) fresh[n - 1].next = NIL;
+        std::size_t count = len;
+        release_slab();
+        slab = fresh;
+        used = cap = count;
+        head = count ? 0 : NIL;
+        tail = count ? static_cast<index_type>(count - 1) : NIL;
+        free_head = NIL;
+    }
+
+    // Clear list (keeps the slab's capacity)
+    void clear() {
+        destroy_values();
+        used = 0;
+        head = tail = free_head = NIL;
+        len = 0;
+    }
+
+    // Print helper (for debugging)
+    void print(std::ostream &os = std::cout) const {
+        os << "[";
+        bool first = true;
+        for (index_type cur = head; cur != NIL; cur = slab[cur].next) {
+            if (!first) os << " -> ";
+            os << slab[cur].val;
+            first = false;
+        }
+        os << "]";
+    }
+};
+
+#endif // SLAB_LINKED_LIST_H
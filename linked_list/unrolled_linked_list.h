@@ -0,0 +1,369 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+  unrolled_linked_list.h
+  - Unrolled (chunked) doubly linked list: UnrolledLinkedList<T, ChunkCap, Alloc>
+  - Each heap node ("chunk") stores up to ChunkCap elements inline, contiguously, so
+    walking the list touches one pointer per ChunkCap elements instead of one per element.
+    The default ChunkCap sizes a chunk to about two cache lines (at least 4 elements).
+  - Same positional semantics as SinglyLinkedList / DoublyLinkedList:
+      • a full chunk is split in half on insert
+      • a chunk that drops below half full is merged with its successor when they fit
+  - Elements live in raw storage (constructed on insert, destroyed on erase).
+    Inserting or erasing inside a chunk shifts at most ChunkCap elements, and may
+    move elements between chunks, so pointers to elements are not stable.
+  - Methods:
+      push_front(v) / push_back(v) / emplace_back(args...)   O(ChunkCap)
+      bool pop_front() / bool pop_back()                     O(ChunkCap)
+      bool insert_at(pos, v) / bool erase_at(pos)            O(n / ChunkCap + ChunkCap)
+      bool remove_value(v)                                   O(n)
+      T* find(v) / T* at_ptr(pos) / T* find_middle()         O(n / ChunkCap + ChunkCap)
+      T* front_ptr() / T* back_ptr()                         O(1)
+        (const overloads of these return const T*)
+      for_each(f)                                            O(n)
+      size() / empty() / chunk_count() / clear() / print()
+*/
+
+template<typename T>
+constexpr std::size_t unrolled_default_capacity() {
+    // two 64-byte cache lines minus the prev/next/count header
+    constexpr std::size_t bytes = 128 - 2 * sizeof(void*) - sizeof(std::uint32_t);
+    return bytes / sizeof(T) >= 4 ? bytes / sizeof(T) : 4;
+}
+
+template<typename T, std::size_t ChunkCap = unrolled_default_capacity<T>(),
+         typename Alloc = std::allocator<T>>
+class UnrolledLinkedList {
+    static_assert(ChunkCap >= 2, "UnrolledLinkedList: ChunkCap must be at least 2");
+
+public:
+    struct Chunk {
+        Chunk *prev;
+        Chunk *next;
+        std::uint32_t count;
+        alignas(T) unsigned char storage[ChunkCap * sizeof(T)];
+
+        Chunk() : prev(nullptr), next(nullptr), count(0) {}
+        T* data() { return std::launder(reinterpret_cast<T*>(storage)); }
+        const T* data() const { return std::launder(reinterpret_cast<const T*>(storage)); }
+    };
+
+private:
+    using ChunkAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Chunk>;
+    using ChunkTraits = std::allocator_traits<ChunkAlloc>;
+
+    static constexpr bool trivial = std::is_trivially_copyable<T>::value;
+
+    Chunk *head;
+    Chunk *tail;
+    std::size_t len;
+    std::size_t chunks;
+    ChunkAlloc alloc;
+
+    // ---- chunk lifetime ----
+
+    Chunk* create_chunk() {
+        Chunk *c = ChunkTraits::allocate(alloc, 1);
+        ChunkTraits::construct(alloc, c);
+        ++chunks;
+        return c;
+    }
+
+    void destroy_chunk(Chunk *c) {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+            for (std::uint32_t i = 0; i < c->count; ++i) c->data()[i].~T();
+        ChunkTraits::destroy(alloc, c);
+        ChunkTraits::deallocate(alloc, c, 1);
+        --chunks;
+    }
+
+    void link_after(Chunk *pos, Chunk *c) {
+        c->prev = pos;
+        c->next = pos ? pos->next : head;
+        if (c->next) c->next->prev = c;
+        else tail = c;
+        if (pos) pos->next = c;
+        else head = c;
+    }
+
+    void unlink(Chunk *c) {
+        if (c->prev) c->prev->next = c->next;
+        else head = c->next;
+        if (c->next) c->next->prev = c->prev;
+        else tail = c->prev;
+    }
+
+    // ---- element moves inside raw storage ----
+
+    // move n constructed elements from src to uninitialized dst (ranges may not overlap)
+    static void relocate(T *dst, T *src, std::size_t n) {
+        if constexpr (trivial) {
+            if (n) std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                ::new (static_cast<void*>(dst + i)) T(std::move(src[i]));
+                src[i].~T();
+            }
+        }
+    }
+
+    // construct an element at idx of a non-full chunk, shifting [idx, count) right
+    template<typename... Args>
+    T& chunk_insert(Chunk *c, std::size_t idx, Args&&... args) {
+        T *d = c->data();
+        std::size_t n = c->count;
+        if (idx == n) {
+            ::new (static_cast<void*>(d + n)) T(std::forward<Args>(args)...);
+        } else if constexpr (trivial) {
+            T tmp(std::forward<Args>(args)...);
+            std::memmove(static_cast<void*>(d + idx + 1), static_cast<const void*>(d + idx), (n - idx) * sizeof(T));
+            ::new (static_cast<void*>(d + idx)) T(tmp);
+        } else {
+            T tmp(std::forward<Args>(args)...);
+            ::new (static_cast<void*>(d + n)) T(std::move(d[n - 1]));
+            for (std::size_t i = n - 1; i > idx; --i) d[i] = std::move(d[i - 1]);
+            d[idx] = std::move(tmp);
+        }
+        ++c->count;
+        return d[idx];
+    }
+
+    // destroy the element at idx, shifting (idx, count) left
+    void chunk_erase(Chunk *c, std::size_t idx) {
+        T *d = c->data();
+        std::size_t n = c->count;
+        if constexpr (trivial) {
+            std::memmove(static_cast<void*>(d + idx), static_cast<const void*>(d + idx + 1), (n - idx - 1) * sizeof(T));
+        } else {
+            for (std::size_t i = idx; i + 1 < n; ++i) d[i] = std::move(d[i + 1]);
+            d[n - 1].~T();
+        }
+        --c->count;
+    }
+
+    // Move the upper half of a full chunk into a new chunk linked after it.
+    Chunk* split(Chunk *c) {
+        Chunk *nc = create_chunk();
+        std::size_t keep = c->count / 2;
+        std::size_t moved = c->count - keep;
+        relocate(nc->data(), c->data() + keep, moved);
+        nc->count = static_cast<std::uint32_t>(moved);
+        c->count = static_cast<std::uint32_t>(keep);
+        link_after(c, nc);
+        return nc;
+    }
+
+    // After an erase: free an empty chunk, or fold an under-full chunk's successor into it.
+    void rebalance(Chunk *c) {
+        if (c->count == 0) {
+            unlink(c);
+            destroy_chunk(c);
+            return;
+        }
+        Chunk *nx = c->next;
+        if (c->count < ChunkCap / 2 && nx && c->count + nx->count <= ChunkCap) {
+            relocate(c->data() + c->count, nx->data(), nx->count);
+            c->count += nx->count;
+            nx->count = 0;
+            unlink(nx);
+            destroy_chunk(nx);
+        }
+    }
+
+    // chunk holding element pos (< len) and the offset inside it; walks from the nearer end
+    Chunk* locate(std::size_t pos, std::size_t &off) const {
+        if (pos < len / 2) {
+            Chunk *c = head;
+            while (pos >= c->count) { pos -= c->count; c = c->next; }
+            off = pos;
+            return c;
+        }
+        std::size_t from_end = len - pos; // >= 1
+        Chunk *c = tail;
+        while (from_end > c->count) { from_end -= c->count; c = c->prev; }
+        off = c->count - from_end;
+        return c;
+    }
+
+public:
+    // Constructors / Destructor
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), len(0), chunks(0), alloc() {}
+    explicit UnrolledLinkedList(const Alloc &a) : head(nullptr), tail(nullptr), len(0), chunks(0), alloc(a) {}
+    UnrolledLinkedList(std::initializer_list<T> il, const Alloc &a = Alloc())
+        : head(nullptr), tail(nullptr), len(0), chunks(0), alloc(a) {
+        for (const T &v : il) push_back(v);
+    }
+
+    ~UnrolledLinkedList() { clear(); }
+
+    // Disable copy (shallow copies are error prone); allow move
+    UnrolledLinkedList(const UnrolledLinkedList &) = delete;
+    UnrolledLinkedList& operator=(const UnrolledLinkedList &) = delete;
+
+    UnrolledLinkedList(UnrolledLinkedList &&other) noexcept
+        : head(other.head), tail(other.tail), len(other.len), chunks(other.chunks), alloc(std::move(other.alloc)) {
+        other.head = other.tail = nullptr;
+        other.len = other.chunks = 0;
+    }
+    UnrolledLinkedList& operator=(UnrolledLinkedList &&other) noexcept {
+        if (this != &other) {
+            clear();
+            alloc = std::move(other.alloc);
+            head = other.head; tail = other.tail; len = other.len; chunks = other.chunks;
+            other.head = other.tail = nullptr;
+            other.len = other.chunks = 0;
+        }
+        return *this;
+    }
+
+    // Basic queries
+    bool empty() const { return len == 0; }
+    std::size_t size() const { return len; }
+    std::size_t chunk_count() const { return chunks; }
+    static constexpr std::size_t chunk_capacity() { return ChunkCap; }
+
+    Chunk* get_head() const { return head; }
+    Chunk* get_tail() const { return tail; }
+
+    // Insert at head
+    void push_front(const T &v) {
+        if (!head || head->count == ChunkCap) link_after(nullptr, create_chunk());
+        chunk_insert(head, 0, v);
+        ++len;
+    }
+
+    // Append at tail (a full tail gets a fresh chunk, so appends fill chunks completely)
+    void push_back(const T &v) { emplace_back(v); }
+    void push_back(T &&v) { emplace_back(std::move(v)); }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (!tail || tail->count == ChunkCap) link_after(tail, create_chunk());
+        T &r = chunk_insert(tail, tail->count, std::forward<Args>(args)...);
+        ++len;
+        return r;
+    }
+
+    // Insert at 0-based position pos (pos == size -> push_back). Returns false if pos > size.
+    bool insert_at(std::size_t pos, const T &v) {
+        if (pos > len) return false;
+        if (pos == len) { push_back(v); return true; }
+        std::size_t off;
+        Chunk *c = locate(pos, off);
+        if (c->count == ChunkCap) {
+            Chunk *nc = split(c);
+            if (off > c->count) { off -= c->count; c = nc; }
+        }
+        chunk_insert(c, off, v);
+        ++len;
+        return true;
+    }
+
+    // Erase at head / tail
+    bool pop_front() { return erase_at(0); }
+    bool pop_back() { return len ? erase_at(len - 1) : false; }
+
+    // Erase element at position pos (0-based). Returns true if erased.
+    bool erase_at(std::size_t pos) {
+        if (pos >= len) return false;
+        std::size_t off;
+        Chunk *c = locate(pos, off);
+        chunk_erase(c, off);
+        --len;
+        rebalance(c);
+        return true;
+    }
+
+    // Remove first occurrence of value v (returns true if removed)
+    bool remove_value(const T &v) {
+        for (Chunk *c = head; c; c = c->next) {
+            T *d = c->data();
+            for (std::uint32_t i = 0; i < c->count; ++i) {
+                if (d[i] == v) {
+                    chunk_erase(c, i);
+                    --len;
+                    rebalance(c);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Linear search (returns pointer to element or nullptr)
+    T* find(const T &v) { return const_cast<T*>(std::as_const(*this).find(v)); }
+    const T* find(const T &v) const {
+        for (const Chunk *c = head; c; c = c->next) {
+            const T *d = c->data();
+            for (std::uint32_t i = 0; i < c->count; ++i)
+                if (d[i] == v) return d + i;
+        }
+        return nullptr;
+    }
+
+    // Element at position (nullptr if out of range)
+    T* at_ptr(std::size_t pos) { return const_cast<T*>(std::as_const(*this).at_ptr(pos)); }
+    const T* at_ptr(std::size_t pos) const {
+        if (pos >= len) return nullptr;
+        std::size_t off;
+        const Chunk *c = locate(pos, off);
+        return c->data() + off;
+    }
+
+    // Middle element (if even, the first of the two middle elements)
+    T* find_middle() { return len ? at_ptr((len - 1) / 2) : nullptr; }
+    const T* find_middle() const { return len ? at_ptr((len - 1) / 2) : nullptr; }
+
+    T* front_ptr() { return len ? head->data() : nullptr; }
+    const T* front_ptr() const { return len ? head->data() : nullptr; }
+    T* back_ptr() { return len ? tail->data() + (tail->count - 1) : nullptr; }
+    const T* back_ptr() const { return len ? tail->data() + (tail->count - 1) : nullptr; }
+
+    // Visit every element front -> back (sequential within each chunk)
+    template<typename F>
+    void for_each(F &&f) const {
+        for (Chunk *c = head; c; c = c->next) {
+            const T *d = c->data();
+            for (std::uint32_t i = 0; i < c->count; ++i) f(d[i]);
+        }
+    }
+
+    // Clear list
+    void clear() {
+        Chunk *c = head;
+        while (c) {
+            Chunk *nx = c->next;
+            destroy_chunk(c);
+            c = nx;
+        }
+        head = tail = nullptr;
+        len = 0;
+    }
+
+    // Print helper (for debugging); chunk boundaries shown as " | "
+    void print(std::ostream &os = std::cout) const {
+        os << "[";
+        for (Chunk *c = head; c; c = c->next) {
+            const T *d = c->data();
+            for (std::uint32_t i = 0; i < c->count; ++i) {
+                if (i) os << " -> ";
+                os << d[i];
+            }
+            if (c->next) os << " | ";
+        }
+        os << "]";
+    }
+};
+
+#endif // UNROLLED_LINKED_LIST_H
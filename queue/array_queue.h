@@ -4,14 +4,21 @@
 #include <cstddef>
 #include <stdexcept>
 #include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "../common/bit_utils.h"
 
 /*
   array_queue.h
   - Fixed-capacity circular queue (ring buffer) template
   - O(1) enqueue/dequeue
+  - Capacity is rounded up to a power of two (index wrap is a mask, not a division)
+  - Only live slots hold constructed elements (dequeue / clear destroy them)
   - Methods:
       ArrayQueue(size_t capacity)
       bool enqueue(const T& val)      // returns false if full
+      bool enqueue(T&& val) / template<class... Args> bool emplace(Args&&...)
       bool dequeue()                  // returns false if empty
       T* front_ptr()                  // pointer to front element or nullptr
       const T* front_ptr() const
@@ -20,34 +27,51 @@
       size_t size() const
       size_t capacity() const
       void clear()
+  - Alloc: buffer allocator (std::allocator by default; see allocators/ for arena & pool)
 */
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>>
 class ArrayQueue {
 private:
+    using Traits = std::allocator_traits<Alloc>;
+
     T *buf;
-    size_t cap;
+    size_t cap;  // always a power of two
+    size_t mask; // cap - 1
     size_t head; // index of front element
     size_t tail; // index of next insertion position
     size_t len;
+    Alloc alloc;
 
+    // raw storage; elements are constructed only in live slots
     void alloc_buf(size_t capacity) {
-        cap = capacity ? capacity : 1;
-        buf = new T[cap];
+        cap = bitutil::next_pow2(capacity ? capacity : 1);
+        mask = cap - 1;
+        buf = Traits::allocate(alloc, cap);
         head = 0;
         tail = 0;
         len = 0;
     }
 
+    void destroy_all() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (size_t i = 0; i < len; ++i) Traits::destroy(alloc, buf + ((head + i) & mask));
+        }
+    }
+
 public:
-    explicit ArrayQueue(size_t capacity = 128) { alloc_buf(capacity); }
+    // capacity is rounded up to a power of two
+    explicit ArrayQueue(size_t capacity = 128, const Alloc &a = Alloc()) : alloc(a) { alloc_buf(capacity); }
 
-    ArrayQueue(std::initializer_list<T> il) { 
+    ArrayQueue(std::initializer_list<T> il, const Alloc &a = Alloc()) : alloc(a) {
         alloc_buf(il.size() ? il.size()*2 : 1);
         for (const T &v : il) enqueue(v);
     }
 
-    ~ArrayQueue() { delete[] buf; }
+    ~ArrayQueue() {
+        destroy_all();
+        Traits::deallocate(alloc, buf, cap);
+    }
 
     // non-copyable for simplicity
     ArrayQueue(const ArrayQueue&) = delete;
@@ -59,10 +83,14 @@ public:
     size_t capacity() const { return cap; }
 
     // enqueue returns false if full
-    bool enqueue(const T &val) {
+    bool enqueue(const T &val) { return emplace(val); }
+    bool enqueue(T &&val) { return emplace(std::move(val)); }
+
+    template<typename... Args>
+    bool emplace(Args&&... args) {
         if (len >= cap) return false;
-        buf[tail] = val;
-        tail = (tail + 1) % cap;
+        Traits::construct(alloc, buf + tail, std::forward<Args>(args)...);
+        tail = (tail + 1) & mask;
         ++len;
         return true;
     }
@@ -70,7 +98,8 @@ public:
     // dequeue returns false if empty
     bool dequeue() {
         if (len == 0) return false;
-        head = (head + 1) % cap;
+        Traits::destroy(alloc, buf + head);
+        head = (head + 1) & mask;
         --len;
         return true;
     }
@@ -88,16 +117,15 @@ public:
     // access back element (last pushed)
     T* back_ptr() {
         if (len == 0) return nullptr;
-        size_t idx = (tail + cap - 1) % cap;
-        return &buf[idx];
+        return &buf[(tail + cap - 1) & mask];
     }
     const T* back_ptr() const {
         if (len == 0) return nullptr;
-        size_t idx = (tail + cap - 1) % cap;
-        return &buf[idx];
+        return &buf[(tail + cap - 1) & mask];
     }
 
     void clear() {
+        destroy_all();
         head = tail = 0;
         len = 0;
     }
@@ -0,0 +1,384 @@
+#ifndef CONCURRENT_LINKED_QUEUE_H
+#define CONCURRENT_LINKED_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+/*
+  concurrent_linked_queue.h
+  - Unbounded thread-safe FIFO: the concurrent counterpart of LinkedQueue.
+  - Michael & Scott's two-lock queue: a dummy node separates the ends, so producers
+    (tail_mu_) and consumers (head_mu_) never take the same lock.
+  - Values are constructed outside the lock. Consumers move the value out under head_mu_,
+    then give the node back in batches.
+  - Node recycling: spent nodes go to a shared free list (capped at max_free nodes) that
+    producers take from before asking the allocator.
+  - Blocking: pop_wait(out) / pop_wait(out, timeout) sleep until an item arrives, the
+    timeout expires or the queue is closed.
+  - Batching: drain_into(vec, max) moves everything available with one lock acquisition.
+  - Backpressure: with a high-water mark hwm > 0, push() blocks while size_approx() >= hwm and
+    try_push() fails instead; 0 means unbounded.
+  - close() wakes every waiter; later pushes fail; pops drain what is left, then fail.
+  - Alloc must be safe to call from several threads (std::allocator is).
+  - Methods:
+      ConcurrentLinkedQueue(size_t high_water_mark = 0, size_t max_free = 1024)
+      bool push(const T&) / bool push(T&&)            // blocks at the high-water mark; false if closed
+      bool try_push(const T&) / bool try_push(T&&)    // false if full or closed
+      template<class... Args> bool emplace(Args&&...)
+      bool try_pop(T& out)                            // false if empty
+      bool pop_wait(T& out)                           // false once closed and empty
+      bool pop_wait(T& out, duration timeout)         // false on timeout, or closed and empty
+      size_t drain_into(std::vector<T>& out, size_t max = SIZE_MAX)
+      void close() / bool closed() const
+      size_t size_approx() const / bool empty_approx() const / size_t high_water_mark() const
+*/
+
+template<typename T, typename Alloc = std::allocator<T>>
+class ConcurrentLinkedQueue {
+private:
+    struct Node {
+        std::atomic<Node*> next;
+        alignas(T) unsigned char storage[sizeof(T)];
+        Node() : next(nullptr) {}
+        T* ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAlloc>;
+
+    static constexpr std::size_t RECYCLE_BATCH = 32;
+
+    // consumer side
+    std::mutex head_mu_;
+    std::condition_variable not_empty_;
+    Node *head_;                  // dummy: the front value lives in head_->next
+    Node *retired_;               // spent nodes waiting to be recycled as a batch
+    std::size_t retired_count_;
+
+    // producer side
+    std::mutex tail_mu_;
+    std::condition_variable not_full_;
+    Node *tail_;
+
+    // recycled nodes
+    std::mutex free_mu_;
+    Node *free_;
+    std::size_t free_count_;
+    std::size_t max_free_;
+
+    std::atomic<std::size_t> size_;
+    std::atomic<std::size_t> waiting_consumers_;
+    std::atomic<std::size_t> waiting_producers_;
+    std::atomic<bool> closed_;
+    std::size_t hwm_;
+    NodeAlloc alloc_;
+
+    Node* allocate_node() {
+        Node *n = NodeTraits::allocate(alloc_, 1);
+        NodeTraits::construct(alloc_, n);
+        return n;
+    }
+
+    void deallocate_node(Node *n) {
+        NodeTraits::destroy(alloc_, n);
+        NodeTraits::deallocate(alloc_, n, 1);
+    }
+
+    void deallocate_list(Node *n) {
+        while (n) {
+            Node *nx = n->next.load(std::memory_order_relaxed);
+            deallocate_node(n);
+            n = nx;
+        }
+    }
+
+    Node* acquire_node() {
+        {
+            std::lock_guard<std::mutex> lk(free_mu_);
+            if (free_) {
+                Node *n = free_;
+                free_ = n->next.load(std::memory_order_relaxed);
+                --free_count_;
+                n->next.store(nullptr, std::memory_order_relaxed);
+                return n;
+            }
+        }
+        return allocate_node();
+    }
+
+    // Hand a batch of spent nodes back to the free list (or the allocator once it is full).
+    void recycle(Node *batch, std::size_t count) {
+        if (!batch) return;
+        {
+            std::lock_guard<std::mutex> lk(free_mu_);
+            if (free_count_ + count <= max_free_) {
+                Node *last = batch;
+                while (Node *nx = last->next.load(std::memory_order_relaxed)) last = nx;
+                last->next.store(free_, std::memory_order_relaxed);
+                free_ = batch;
+                free_count_ += count;
+                return;
+            }
+        }
+        deallocate_list(batch);
+    }
+
+    // head_mu_ held: park the old dummy; returns a batch to recycle once the lock is dropped
+    Node* retire(Node *old, std::size_t &batch_count) {
+        old->next.store(retired_, std::memory_order_relaxed);
+        retired_ = old;
+        if (++retired_count_ < RECYCLE_BATCH) return nullptr;
+        Node *batch = retired_;
+        batch_count = retired_count_;
+        retired_ = nullptr;
+        retired_count_ = 0;
+        return batch;
+    }
+
+    // head_mu_ held, queue non-empty: move the front value out and advance the dummy
+    Node* take_front(T &out, std::size_t &batch_count) {
+        Node *old = head_;
+        Node *first = old->next.load(std::memory_order_acquire);
+        T *p = first->ptr();
+        out = std::move(*p);
+        p->~T();
+        head_ = first;                      // first becomes the new dummy
+        return retire(old, batch_count);
+    }
+
+    void after_pop(std::size_t popped) {
+        size_.fetch_sub(popped, std::memory_order_seq_cst);
+        if (hwm_ && waiting_producers_.load(std::memory_order_seq_cst) > 0) {
+            { std::lock_guard<std::mutex> lk(tail_mu_); }
+            if (popped > 1) not_full_.notify_all();
+            else not_full_.notify_one();
+        }
+    }
+
+    bool has_front() const { return head_->next.load(std::memory_order_seq_cst) != nullptr; }
+
+    // Link a node whose value is already constructed. `block` selects push vs try_push.
+    bool link(Node *n, bool block) {
+        {
+            std::unique_lock<std::mutex> lk(tail_mu_);
+            if (hwm_ && !closed_.load(std::memory_order_relaxed) &&
+                size_.load(std::memory_order_seq_cst) >= hwm_) {
+                if (block) {
+                    waiting_producers_.fetch_add(1, std::memory_order_seq_cst);
+                    not_full_.wait(lk, [this] {
+                        return closed_.load(std::memory_order_relaxed) ||
+                               size_.load(std::memory_order_seq_cst) < hwm_;
+                    });
+                    waiting_producers_.fetch_sub(1, std::memory_order_relaxed);
+                } else {
+                    lk.unlock();
+                    discard(n);
+                    return false;
+                }
+            }
+            if (closed_.load(std::memory_order_relaxed)) {
+                lk.unlock();
+                discard(n);
+                return false;
+            }
+            size_.fetch_add(1, std::memory_order_seq_cst);     // before linking: never underflows
+            tail_->next.store(n, std::memory_order_seq_cst);   // publish to consumers
+            tail_ = n;
+        }
+        if (waiting_consumers_.load(std::memory_order_seq_cst) > 0) {
+            // take the lock so a consumer between its check and its wait can't miss this
+            { std::lock_guard<std::mutex> lk(head_mu_); }
+            not_empty_.notify_one();
+        }
+        return true;
+    }
+
+    void discard(Node *n) {
+        n->ptr()->~T();
+        n->next.store(nullptr, std::memory_order_relaxed);
+        recycle(n, 1);
+    }
+
+    template<typename... Args>
+    bool emplace_impl(bool block, Args&&... args) {
+        if (closed_.load(std::memory_order_relaxed)) return false;
+        Node *n = acquire_node();
+        try {
+            ::new (static_cast<void*>(n->storage)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            recycle(n, 1);
+            throw;
+        }
+        return link(n, block);
+    }
+
+public:
+    explicit ConcurrentLinkedQueue(std::size_t high_water_mark = 0, std::size_t max_free = 1024,
+                                   const Alloc &a = Alloc())
+        : head_(nullptr), retired_(nullptr), retired_count_(0), tail_(nullptr),
+          free_(nullptr), free_count_(0), max_free_(max_free),
+          size_(0), waiting_consumers_(0), waiting_producers_(0), closed_(false),
+          hwm_(high_water_mark), alloc_(a) {
+        head_ = tail_ = allocate_node();
+    }
+
+    // Destroys queued values and frees every node; no other thread may be using the queue.
+    ~ConcurrentLinkedQueue() {
+        Node *n = head_->next.load(std::memory_order_relaxed);
+        deallocate_node(head_);
+        while (n) {
+            Node *nx = n->next.load(std::memory_order_relaxed);
+            n->ptr()->~T();
+            deallocate_node(n);
+            n = nx;
+        }
+        deallocate_list(retired_);
+        deallocate_list(free_);
+    }
+
+    // non-copyable, non-movable (shared between threads by reference)
+    ConcurrentLinkedQueue(const ConcurrentLinkedQueue&) = delete;
+    ConcurrentLinkedQueue& operator=(const ConcurrentLinkedQueue&) = delete;
+
+    std::size_t size_approx() const { return size_.load(std::memory_order_relaxed); }
+    bool empty_approx() const { return size_approx() == 0; }
+    std::size_t high_water_mark() const { return hwm_; }
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+    // Producers: blocking at the high-water mark
+    bool push(const T &v) { return emplace_impl(true, v); }
+    bool push(T &&v) { return emplace_impl(true, std::move(v)); }
+    template<typename... Args>
+    bool emplace(Args&&... args) { return emplace_impl(true, std::forward<Args>(args)...); }
+
+    // Producers: never block
+    bool try_push(const T &v) {
+        if (hwm_ && size_.load(std::memory_order_relaxed) >= hwm_) return false;  // cheap precheck
+        return emplace_impl(false, v);
+    }
+    bool try_push(T &&v) {
+        if (hwm_ && size_.load(std::memory_order_relaxed) >= hwm_) return false;
+        return emplace_impl(false, std::move(v));
+    }
+
+    bool try_pop(T &out) {
+        Node *batch = nullptr;
+        std::size_t batch_count = 0;
+        {
+            std::lock_guard<std::mutex> lk(head_mu_);
+            if (!has_front()) return false;
+            batch = take_front(out, batch_count);
+        }
+        recycle(batch, batch_count);
+        after_pop(1);
+        return true;
+    }
+
+    // Block until a value arrives; false only once the queue is closed and empty.
+    bool pop_wait(T &out) {
+        Node *batch = nullptr;
+        std::size_t batch_count = 0;
+        {
+            std::unique_lock<std::mutex> lk(head_mu_);
+            if (!has_front()) {
+                waiting_consumers_.fetch_add(1, std::memory_order_seq_cst);
+                not_empty_.wait(lk, [this] { return has_front() || closed_.load(std::memory_order_acquire); });
+                waiting_consumers_.fetch_sub(1, std::memory_order_relaxed);
+                if (!has_front()) return false;
+            }
+            batch = take_front(out, batch_count);
+        }
+        recycle(batch, batch_count);
+        after_pop(1);
+        return true;
+    }
+
+    // Like pop_wait(out), but gives up after timeout (returns false).
+    template<typename Rep, typename Period>
+    bool pop_wait(T &out, const std::chrono::duration<Rep, Period> &timeout) {
+        Node *batch = nullptr;
+        std::size_t batch_count = 0;
+        {
+            std::unique_lock<std::mutex> lk(head_mu_);
+            if (!has_front()) {
+                waiting_consumers_.fetch_add(1, std::memory_order_seq_cst);
+                not_empty_.wait_for(lk, timeout, [this] { return has_front() || closed_.load(std::memory_order_acquire); });
+                waiting_consumers_.fetch_sub(1, std::memory_order_relaxed);
+                if (!has_front()) return false;
+            }
+            batch = take_front(out, batch_count);
+        }
+        recycle(batch, batch_count);
+        after_pop(1);
+        return true;
+    }
+
+    // Move up to max available values to the back of out with one lock acquisition.
+    // Returns how many were moved (0 if empty); never blocks. If out.push_back throws,
+    // the values already moved stay dequeued, the rest stay queued, and the exception
+    // propagates.
+    std::size_t drain_into(std::vector<T> &out, std::size_t max = std::numeric_limits<std::size_t>::max()) {
+        if (max == 0) return 0;
+        // grow out before taking the lock (a hint: producers may add more meanwhile)
+        out.reserve(out.size() + std::min(max, size_approx()));
+        Node *spent = nullptr;   // drained chain plus earlier retirees, recycled after unlocking
+        std::size_t spent_count = 0;
+        std::size_t count = 0;
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lk(head_mu_);
+            if (!has_front()) return 0;
+            Node *prev = nullptr;
+            Node *cur = head_;
+            Node *nx;
+            try {
+                while (count < max && (nx = cur->next.load(std::memory_order_acquire)) != nullptr) {
+                    T *p = nx->ptr();
+                    out.push_back(std::move(*p));   // on throw nx still holds a live value
+                    p->~T();
+                    prev = cur;
+                    cur = nx;
+                    ++count;
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+            if (count) {
+                // [head_, cur) are spent; the last drained node becomes the new dummy
+                prev->next.store(retired_, std::memory_order_relaxed);
+                spent = head_;
+                spent_count = count + retired_count_;
+                retired_ = nullptr;
+                retired_count_ = 0;
+                head_ = cur;
+            }
+        }
+        if (count) {
+            recycle(spent, spent_count);
+            after_pop(count);
+        }
+        if (error) std::rethrow_exception(error);
+        return count;
+    }
+
+    // Stop accepting values and wake every waiting producer and consumer.
+    void close() {
+        closed_.store(true, std::memory_order_seq_cst);
+        { std::lock_guard<std::mutex> lk(head_mu_); }
+        not_empty_.notify_all();
+        { std::lock_guard<std::mutex> lk(tail_mu_); }
+        not_full_.notify_all();
+    }
+};
+
+#endif // CONCURRENT_LINKED_QUEUE_H
@@ -2,72 +2,107 @@
 #define DEQUE_H
 
 #include <cstddef>
+#include <cstring>
 #include <algorithm>
 #include <stdexcept>
 #include <initializer_list>
 #include <utility>
 #include <iterator>
 #include <vector>
+#include <memory>
+#include <type_traits>
+#include "../common/bit_utils.h"
 
 /*
   deque.h
   - Dynamic circular-buffer deque (double-ended queue)
   - Amortized O(1) push/pop at both ends
   - Random access via operator[]
-  - Automatic growth (capacity doubles when full)
+  - Automatic growth (capacity doubles when full; trivially copyable T is memcpy'd as
+    two contiguous runs, other T moved element by element with a rollback if one throws)
+  - Capacity is always a power of two, so index wrap is a mask instead of a division
+  - Only live slots hold constructed elements (pop / clear destroy them)
   - Non-copyable for simplicity; moveable
+  - Alloc: buffer allocator (std::allocator by default; see allocators/ for arena & pool)
 */
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>>
 class Deque {
 private:
+    using Traits = std::allocator_traits<Alloc>;
+
     T *buf;
-    std::size_t cap;   // capacity of buffer
+    std::size_t cap;   // capacity of buffer (always a power of two)
+    std::size_t mask;  // cap - 1: slot of logical position i is (head + i) & mask
     std::size_t head;  // index of first element
     std::size_t len;   // number of elements
+    Alloc alloc;
+
+    std::size_t slot(std::size_t idx) const { return (head + idx) & mask; }
 
-    static std::size_t next_pow2(std::size_t x) {
-        if (x == 0) return 1;
-        --x;
-        for (std::size_t i = 1; i < sizeof(std::size_t) * 8; i <<= 1) x |= x >> i;
-        return ++x;
+    // Destroy the live elements (slots outside [head, head + len) hold nothing)
+    void destroy_all() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for (std::size_t i = 0; i < len; ++i) Traits::destroy(alloc, buf + slot(i));
+        }
     }
 
+    void release() {
+        if (!buf) return;
+        destroy_all();
+        Traits::deallocate(alloc, buf, cap);
+    }
+
+    // raw storage; elements are constructed only in live slots
     void allocate(std::size_t capacity) {
-        cap = capacity ? capacity : 1;
-        buf = new T[cap];
+        cap = bitutil::next_pow2(capacity ? capacity : 1);
+        mask = cap - 1;
+        buf = Traits::allocate(alloc, cap);
         head = 0;
         len = 0;
     }
 
+    // Move the live elements into a buffer twice the size. Strong guarantee: if a
+    // (copy) constructor throws, the new buffer is released and *this is untouched.
     void grow_if_full() {
         if (len < cap) return;
         std::size_t newCap = cap ? cap * 2 : 1;
-        T *nb = new T[newCap];
-        // copy existing elements in order
-        for (std::size_t i = 0; i < len; ++i) nb[i] = std::move(buf[(head + i) % cap]);
-        delete[] buf;
+        T *nb = Traits::allocate(alloc, newCap);
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            // the live range wraps at most once: copy it as two contiguous runs, front first
+            std::size_t first = std::min(len, cap - head);
+            if (first) std::memcpy(static_cast<void*>(nb), static_cast<const void*>(buf + head), first * sizeof(T));
+            if (len > first) std::memcpy(static_cast<void*>(nb + first), static_cast<const void*>(buf), (len - first) * sizeof(T));
+        } else {
+            std::size_t i = 0;
+            try {
+                for (; i < len; ++i) Traits::construct(alloc, nb + i, std::move_if_noexcept(buf[slot(i)]));
+            } catch (...) {
+                while (i > 0) Traits::destroy(alloc, nb + --i);
+                Traits::deallocate(alloc, nb, newCap);
+                throw;
+            }
+            destroy_all();
+        }
+        if (buf) Traits::deallocate(alloc, buf, cap);
         buf = nb;
         cap = newCap;
+        mask = newCap - 1;
         head = 0;
     }
 
 public:
-    // Constructors / destructor
-    Deque(std::size_t initial_capacity = 16) {
-        std::size_t c = initial_capacity ? initial_capacity : 1;
-        // normalize to power-of-two for slightly better wrap arithmetic (optional)
-        c = next_pow2(c);
-        allocate(c);
+    // Constructors / destructor (capacity is rounded up to a power of two)
+    Deque(std::size_t initial_capacity = 16, const Alloc &a = Alloc()) : alloc(a) {
+        allocate(initial_capacity);
     }
 
-    Deque(std::initializer_list<T> il) {
-        std::size_t c = next_pow2(il.size() ? il.size() * 2 : 1);
-        allocate(c);
+    Deque(std::initializer_list<T> il, const Alloc &a = Alloc()) : alloc(a) {
+        allocate(il.size() ? il.size() * 2 : 1);
         for (const T &v : il) push_back(v);
     }
 
-    ~Deque() { delete[] buf; }
+    ~Deque() { release(); }
 
     // Non-copyable (to avoid accidental shallow copies)
     Deque(const Deque&) = delete;
@@ -75,14 +110,16 @@ public:
 
     // Moveable
     Deque(Deque &&other) noexcept
-        : buf(other.buf), cap(other.cap), head(other.head), len(other.len) {
-        other.buf = nullptr; other.cap = 0; other.head = 0; other.len = 0;
+        : buf(other.buf), cap(other.cap), mask(other.mask), head(other.head), len(other.len),
+          alloc(std::move(other.alloc)) {
+        other.buf = nullptr; other.cap = 0; other.mask = 0; other.head = 0; other.len = 0;
     }
     Deque& operator=(Deque &&other) noexcept {
         if (this != &other) {
-            delete[] buf;
-            buf = other.buf; cap = other.cap; head = other.head; len = other.len;
-            other.buf = nullptr; other.cap = 0; other.head = 0; other.len = 0;
+            release();
+            alloc = std::move(other.alloc);
+            buf = other.buf; cap = other.cap; mask = other.mask; head = other.head; len = other.len;
+            other.buf = nullptr; other.cap = 0; other.mask = 0; other.head = 0; other.len = 0;
         }
         return *this;
     }
@@ -95,11 +132,11 @@ public:
     // Access by index (0 = front)
     T& operator[](std::size_t idx) {
         if (idx >= len) throw std::out_of_range("Deque::operator[] index out of range");
-        return buf[(head + idx) % cap];
+        return buf[slot(idx)];
     }
     const T& operator[](std::size_t idx) const {
         if (idx >= len) throw std::out_of_range("Deque::operator[] index out of range");
-        return buf[(head + idx) % cap];
+        return buf[slot(idx)];
     }
 
     // Front / Back access (nullptr-style safe pointers)
@@ -110,43 +147,53 @@ public:
         return len ? &buf[head] : nullptr;
     }
     T* back_ptr() {
-        return len ? &buf[(head + len - 1) % cap] : nullptr;
+        return len ? &buf[slot(len - 1)] : nullptr;
     }
     const T* back_ptr() const {
-        return len ? &buf[(head + len - 1) % cap] : nullptr;
+        return len ? &buf[slot(len - 1)] : nullptr;
     }
 
     // Push to front
-    void push_front(const T &v) {
-        grow_if_full();
-        // new head index = (head + cap - 1) % cap
-        head = (head + cap - 1) % cap;
-        buf[head] = v;
-        ++len;
-    }
-    void push_front(T &&v) {
-        grow_if_full();
-        head = (head + cap - 1) % cap;
-        buf[head] = std::move(v);
+    void push_front(const T &v) { emplace_front(v); }
+    void push_front(T &&v) { emplace_front(std::move(v)); }
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (len == cap) {
+            // args may refer into this deque: build the value before growth moves it
+            T tmp(std::forward<Args>(args)...);
+            grow_if_full();
+            return emplace_front(std::move(tmp));
+        }
+        std::size_t h = (head + cap - 1) & mask;
+        Traits::construct(alloc, buf + h, std::forward<Args>(args)...);
+        head = h;
         ++len;
+        return buf[h];
     }
 
     // Push to back
-    void push_back(const T &v) {
-        grow_if_full();
-        buf[(head + len) % cap] = v;
-        ++len;
-    }
-    void push_back(T &&v) {
-        grow_if_full();
-        buf[(head + len) % cap] = std::move(v);
+    void push_back(const T &v) { emplace_back(v); }
+    void push_back(T &&v) { emplace_back(std::move(v)); }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (len == cap) {
+            T tmp(std::forward<Args>(args)...);
+            grow_if_full();
+            return emplace_back(std::move(tmp));
+        }
+        T *p = buf + slot(len);
+        Traits::construct(alloc, p, std::forward<Args>(args)...);
         ++len;
+        return *p;
     }
 
     // Pop from front (returns false if empty)
     bool pop_front() {
         if (len == 0) return false;
-        head = (head + 1) % cap;
+        Traits::destroy(alloc, buf + head);
+        head = (head + 1) & mask;
         --len;
         return true;
     }
@@ -155,12 +202,13 @@ public:
     bool pop_back() {
         if (len == 0) return false;
         --len;
-        // no need to clear value; just shrink
+        Traits::destroy(alloc, buf + slot(len));
         return true;
     }
 
     // Clear contents (doesn't deallocate buffer)
     void clear() {
+        destroy_all();
         head = 0;
         len = 0;
     }
@@ -170,9 +218,11 @@ public:
     std::vector<Out> to_vector() const {
         std::vector<Out> out;
         out.reserve(len);
-        for (std::size_t i = 0; i < len; ++i) out.push_back(static_cast<Out>(buf[(head + i) % cap]));
+        for (std::size_t i = 0; i < len; ++i) out.push_back(static_cast<Out>(buf[slot(i)]));
         return out;
     }
+
+    Alloc get_allocator() const { return alloc; }
 };
 
 #endif // DEQUE_H
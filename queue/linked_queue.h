@@ -6,6 +6,8 @@
 #include <initializer_list>
 #include <stdexcept>
 #include <iostream>
+#include <memory>
+#include "../allocators/node_alloc.h"
 
 /*
   linked_queue.h
@@ -13,6 +15,7 @@
   - O(1) enqueue and dequeue
   - Supports: enqueue, dequeue, front_ptr, back_ptr, size, empty, clear
   - Moveable but non-copyable (to avoid shallow-copy issues)
+  - Alloc: node allocator (std::allocator by default; see allocators/ for arena & pool)
 */
 
 template<typename T>
@@ -23,17 +26,21 @@ struct QNode {
     QNode(T &&v) : val(std::move(v)), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>>
 class LinkedQueue {
 private:
     QNode<T> *head; // front
     QNode<T> *tail; // back (last element)
     std::size_t len;
 
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<QNode<T>>;
+    NodeAlloc alloc;
+
 public:
     // Constructors / Destructor
-    LinkedQueue() : head(nullptr), tail(nullptr), len(0) {}
-    LinkedQueue(std::initializer_list<T> il) : head(nullptr), tail(nullptr), len(0) {
+    LinkedQueue() : head(nullptr), tail(nullptr), len(0), alloc() {}
+    explicit LinkedQueue(const Alloc &a) : head(nullptr), tail(nullptr), len(0), alloc(a) {}
+    LinkedQueue(std::initializer_list<T> il, const Alloc &a = Alloc()) : head(nullptr), tail(nullptr), len(0), alloc(a) {
         for (const T &v : il) enqueue(v);
     }
     ~LinkedQueue() { clear(); }
@@ -44,13 +51,14 @@ public:
 
     // Moveable
     LinkedQueue(LinkedQueue &&other) noexcept
-        : head(other.head), tail(other.tail), len(other.len) {
+        : head(other.head), tail(other.tail), len(other.len), alloc(std::move(other.alloc)) {
         other.head = other.tail = nullptr;
         other.len = 0;
     }
     LinkedQueue& operator=(LinkedQueue &&other) noexcept {
         if (this != &other) {
             clear();
+            alloc = std::move(other.alloc);
             head = other.head;
             tail = other.tail;
             len = other.len;
@@ -66,7 +74,7 @@ public:
 
     // Enqueue (copy)
     void enqueue(const T &v) {
-        QNode<T> *n = new QNode<T>(v);
+        QNode<T> *n = nodealloc::create_node(alloc, v);
         if (!tail) {
             head = tail = n;
         } else {
@@ -78,7 +86,7 @@ public:
 
     // Enqueue (move)
     void enqueue(T &&v) {
-        QNode<T> *n = new QNode<T>(std::move(v));
+        QNode<T> *n = nodealloc::create_node(alloc, std::move(v));
         if (!tail) {
             head = tail = n;
         } else {
@@ -94,7 +102,7 @@ public:
         QNode<T> *tmp = head;
         head = head->next;
         if (!head) tail = nullptr;
-        delete tmp;
+        nodealloc::destroy_node(alloc, tmp);
         --len;
         return true;
     }
@@ -127,7 +135,7 @@ public:
         QNode<T> *cur = head;
         while (cur) {
             QNode<T> *nx = cur->next;
-            delete cur;
+            nodealloc::destroy_node(alloc, cur);
             cur = nx;
         }
         head = tail = nullptr;
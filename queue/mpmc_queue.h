@@ -0,0 +1,223 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../common/bit_utils.h"
+
+/*
+  mpmc_queue.h
+  - Lock-free bounded multi-producer / multi-consumer ring queue (Vyukov's design):
+    the concurrent counterpart of ArrayQueue
+  - Every slot carries a sequence number that says whose turn it is:
+      seq == pos            -> free for the producer that claims position pos
+      seq == pos + 1        -> holds the element for the consumer that claims pos
+      seq == pos + capacity -> free again for the next lap
+    Producers and consumers claim positions with one CAS on tail / head and then touch
+    only their own slot, so there is no lock and no ABA problem.
+  - head and tail sit on separate cache lines so producers and consumers don't false-share.
+  - Capacity is rounded up to a power of two (index = pos & mask).
+  - Bulk variants claim a whole run of ready slots with a single CAS.
+  - A claimed slot must always be published, or every consumer stalls at it for good, so
+    nothing that can throw runs between a claim and its publish: T must be nothrow
+    move-constructible, move-assignable and destructible, and a value whose construction
+    may throw is built before its slot is claimed and then moved in.
+  - Methods:
+      MPMCQueue(size_t capacity)
+      bool try_enqueue(const T& v) / bool try_enqueue(T&& v)   // false if full
+      template<class... Args> bool try_emplace(Args&&...)
+      bool try_dequeue(T& out)                                 // false if empty
+      size_t try_enqueue_bulk(const T* items, size_t n)        // returns number enqueued (prefix)
+      size_t try_dequeue_bulk(T* out, size_t max)              // returns number dequeued
+      size_t capacity() const
+      size_t size_approx() const                               // exact only when quiescent
+      bool empty_approx() const
+*/
+
+template<typename T>
+class MPMCQueue {
+    static_assert(std::is_nothrow_move_constructible<T>::value &&
+                  std::is_nothrow_move_assignable<T>::value &&
+                  std::is_nothrow_destructible<T>::value,
+                  "MPMCQueue: moving or destroying T must not throw (a claimed slot would never be published)");
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> seq;
+        alignas(T) unsigned char storage[sizeof(T)];
+        T* ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_; // next position to enqueue
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_; // next position to dequeue
+    // (alignas also rounds sizeof(MPMCQueue) up, so head_ owns its line)
+
+    static std::intptr_t dif(std::size_t a, std::size_t b) {
+        return static_cast<std::intptr_t>(a - b);
+    }
+
+    // Claim one position for writing; returns the cell or nullptr if the queue is full.
+    Cell* claim_enqueue(std::size_t &pos) {
+        pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &c = cells_[pos & mask_];
+            std::size_t seq = c.seq.load(std::memory_order_acquire);
+            std::intptr_t d = dif(seq, pos);
+            if (d == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) return &c;
+            } else if (d < 0) {
+                return nullptr; // slot still holds last lap's element: full
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+public:
+    explicit MPMCQueue(std::size_t capacity = 1024) {
+        std::size_t cap = bitutil::next_pow2(capacity < 2 ? 2 : capacity);
+        cells_.reset(new Cell[cap]);
+        mask_ = cap - 1;
+        for (std::size_t i = 0; i < cap; ++i) cells_[i].seq.store(i, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        head_.store(0, std::memory_order_relaxed);
+    }
+
+    // Destroys elements still queued; no other thread may be using the queue.
+    ~MPMCQueue() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            std::size_t t = tail_.load(std::memory_order_relaxed);
+            for (std::size_t h = head_.load(std::memory_order_relaxed); h != t; ++h) {
+                Cell &c = cells_[h & mask_];
+                if (c.seq.load(std::memory_order_relaxed) == h + 1) c.ptr()->~T();
+            }
+        }
+    }
+
+    // non-copyable, non-movable (shared between threads by reference)
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    std::size_t size_approx() const {
+        std::size_t t = tail_.load(std::memory_order_relaxed);
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        return t > h ? t - h : 0;
+    }
+    bool empty_approx() const { return size_approx() == 0; }
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+            std::size_t pos;
+            Cell *c = claim_enqueue(pos);
+            if (!c) return false;
+            ::new (static_cast<void*>(c->storage)) T(std::forward<Args>(args)...);
+            c->seq.store(pos + 1, std::memory_order_release); // publish to consumers
+            return true;
+        } else {
+            // may throw: build it while nothing is claimed, then move it in
+            T tmp(std::forward<Args>(args)...);
+            return try_emplace(std::move(tmp));
+        }
+    }
+
+    bool try_enqueue(const T &v) { return try_emplace(v); }
+    bool try_enqueue(T &&v) { return try_emplace(std::move(v)); }
+
+    bool try_dequeue(T &out) {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell &c = cells_[pos & mask_];
+            std::size_t seq = c.seq.load(std::memory_order_acquire);
+            std::intptr_t d = dif(seq, pos + 1);
+            if (d == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    T *p = c.ptr();
+                    out = std::move(*p);
+                    p->~T();
+                    c.seq.store(pos + mask_ + 1, std::memory_order_release); // free for next lap
+                    return true;
+                }
+            } else if (d < 0) {
+                return false; // slot not written yet: empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Enqueue up to n items (a prefix of items) with one CAS; returns how many were enqueued.
+    // A free slot can only be taken by whoever moves tail past it, so the slots checked
+    // before the CAS stay free once it succeeds.
+    // If copying T may throw, items are enqueued one at a time instead (each copy is made
+    // before its slot is claimed); the result is still the enqueued prefix.
+    std::size_t try_enqueue_bulk(const T *items, std::size_t n) {
+        if (n == 0) return 0;
+        if constexpr (!std::is_nothrow_copy_constructible<T>::value) {
+            std::size_t k = 0;
+            while (k < n && try_emplace(items[k])) ++k;
+            return k;
+        }
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::size_t k = 0;
+            while (k < n && k <= mask_ &&
+                   cells_[(pos + k) & mask_].seq.load(std::memory_order_acquire) == pos + k) ++k;
+            if (k == 0) {
+                std::size_t seq = cells_[pos & mask_].seq.load(std::memory_order_acquire);
+                if (dif(seq, pos) < 0) return 0; // full
+                pos = tail_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (tail_.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) {
+                for (std::size_t i = 0; i < k; ++i) {
+                    Cell &c = cells_[(pos + i) & mask_];
+                    ::new (static_cast<void*>(c.storage)) T(items[i]);
+                    c.seq.store(pos + i + 1, std::memory_order_release);
+                }
+                return k;
+            }
+        }
+    }
+
+    // Dequeue up to max items into out with one CAS; returns how many were dequeued.
+    std::size_t try_dequeue_bulk(T *out, std::size_t max) {
+        if (max == 0) return 0;
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::size_t k = 0;
+            while (k < max && k <= mask_ &&
+                   cells_[(pos + k) & mask_].seq.load(std::memory_order_acquire) == pos + k + 1) ++k;
+            if (k == 0) {
+                std::size_t seq = cells_[pos & mask_].seq.load(std::memory_order_acquire);
+                if (dif(seq, pos + 1) < 0) return 0; // empty
+                pos = head_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (head_.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) {
+                for (std::size_t i = 0; i < k; ++i) {
+                    Cell &c = cells_[(pos + i) & mask_];
+                    T *p = c.ptr();
+                    out[i] = std::move(*p);
+                    p->~T();
+                    c.seq.store(pos + i + mask_ + 1, std::memory_order_release);
+                }
+                return k;
+            }
+        }
+    }
+};
+
+#endif // MPMC_QUEUE_H
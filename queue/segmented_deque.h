@@ -0,0 +1,297 @@
+#ifndef SEGMENTED_DEQUE_H
+#define SEGMENTED_DEQUE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+  segmented_deque.h
+  - Block-map deque (the libstdc++ std::deque layout, with a tunable block size):
+      SegmentedDeque<T, BlockSize = segmented_default_block<T>(), Alloc = std::allocator<T>>
+  - Elements live in fixed-size blocks; a small circular map of block pointers keeps them
+    in order. Growth allocates one block (plus, rarely, a map twice the size), so:
+      * elements never move: pointers/references stay valid until that element is popped
+      * push/pop are O(1) without the full-buffer copy of Deque::grow_if_full (map growth
+        copies only size/BlockSize pointers)
+  - BlockSize must be a power of two (block/slot split is a shift and a mask).
+  - One emptied block is kept as a spare so push/pop oscillating at a block edge does
+    not hit the allocator every time.
+  - Methods:
+      push_front / push_back (const T& / T&&), emplace_front / emplace_back
+      bool pop_front() / bool pop_back()             // false if empty
+      T& operator[](idx)                             // bounds-checked, throws std::out_of_range
+      T* front_ptr() / T* back_ptr()                 // nullptr if empty
+      size() / empty() / clear()
+      size_t block_count() const                     // blocks currently in use
+      to_vector()
+      template<class F> void for_each(F f)           // front -> back, block by block
+*/
+
+// Default: about 512 bytes per block, at least 16 elements (power of two).
+template<typename T>
+constexpr std::size_t segmented_default_block() {
+    std::size_t n = 16;
+    while (n * sizeof(T) < 512) n <<= 1;
+    return n;
+}
+
+template<typename T, std::size_t BlockSize = segmented_default_block<T>(),
+         typename Alloc = std::allocator<T>>
+class SegmentedDeque {
+    static_assert(BlockSize >= 2 && (BlockSize & (BlockSize - 1)) == 0,
+                  "SegmentedDeque: BlockSize must be a power of two >= 2");
+
+private:
+    using Traits = std::allocator_traits<Alloc>;
+    using MapAlloc = typename Traits::template rebind_alloc<T*>;
+    using MapTraits = std::allocator_traits<MapAlloc>;
+
+    static constexpr std::size_t BLOCK_MASK = BlockSize - 1;
+
+    T **map;               // circular array of block pointers
+    std::size_t map_cap;   // power of two
+    std::size_t map_head;  // map slot of the first block in use
+    std::size_t nblocks;   // blocks in use: map[map_head .. map_head + nblocks)
+    std::size_t head;      // offset of the front element inside the first block
+    std::size_t len;
+    T *spare;              // one cached empty block
+    Alloc alloc;
+
+    T*& block_at(std::size_t b) const { return map[(map_head + b) & (map_cap - 1)]; }
+
+    T* slot_ptr(std::size_t idx) const {
+        std::size_t off = head + idx;
+        return block_at(off / BlockSize) + (off & BLOCK_MASK);
+    }
+
+    T* acquire_block() {
+        if (spare) {
+            T *b = spare;
+            spare = nullptr;
+            return b;
+        }
+        return Traits::allocate(alloc, BlockSize);
+    }
+
+    void release_block(T *b) {
+        if (!spare) spare = b;
+        else Traits::deallocate(alloc, b, BlockSize);
+    }
+
+    // Make room for one more block pointer; only the map is copied, never elements.
+    void reserve_map_slot() {
+        if (nblocks < map_cap) return;
+        MapAlloc ma(alloc);
+        std::size_t new_cap = map_cap ? map_cap * 2 : 8;
+        T **nm = MapTraits::allocate(ma, new_cap);
+        for (std::size_t b = 0; b < nblocks; ++b) nm[b] = block_at(b);
+        if (map) MapTraits::deallocate(ma, map, map_cap);
+        map = nm;
+        map_cap = new_cap;
+        map_head = 0;
+    }
+
+    void free_all() {
+        clear();
+        if (spare) Traits::deallocate(alloc, spare, BlockSize);
+        spare = nullptr;
+        if (map) {
+            MapAlloc ma(alloc);
+            MapTraits::deallocate(ma, map, map_cap);
+        }
+        map = nullptr;
+        map_cap = 0;
+    }
+
+    void reset_empty() {
+        map = nullptr;
+        map_cap = map_head = nblocks = head = len = 0;
+        spare = nullptr;
+    }
+
+public:
+    SegmentedDeque() { reset_empty(); }
+    explicit SegmentedDeque(const Alloc &a) : alloc(a) { reset_empty(); }
+    SegmentedDeque(std::initializer_list<T> il, const Alloc &a = Alloc()) : alloc(a) {
+        reset_empty();
+        for (const T &v : il) push_back(v);
+    }
+
+    ~SegmentedDeque() { free_all(); }
+
+    // Non-copyable (to avoid accidental shallow copies)
+    SegmentedDeque(const SegmentedDeque&) = delete;
+    SegmentedDeque& operator=(const SegmentedDeque&) = delete;
+
+    // Moveable
+    SegmentedDeque(SegmentedDeque &&other) noexcept
+        : map(other.map), map_cap(other.map_cap), map_head(other.map_head), nblocks(other.nblocks),
+          head(other.head), len(other.len), spare(other.spare), alloc(std::move(other.alloc)) {
+        other.reset_empty();
+    }
+    SegmentedDeque& operator=(SegmentedDeque &&other) noexcept {
+        if (this != &other) {
+            free_all();
+            alloc = std::move(other.alloc);
+            map = other.map; map_cap = other.map_cap; map_head = other.map_head;
+            nblocks = other.nblocks; head = other.head; len = other.len; spare = other.spare;
+            other.reset_empty();
+        }
+        return *this;
+    }
+
+    // Capacity & size
+    bool empty() const { return len == 0; }
+    std::size_t size() const { return len; }
+    std::size_t block_count() const { return nblocks; }
+    static constexpr std::size_t block_size() { return BlockSize; }
+
+    // Access by index (0 = front)
+    T& operator[](std::size_t idx) {
+        if (idx >= len) throw std::out_of_range("SegmentedDeque::operator[] index out of range");
+        return *slot_ptr(idx);
+    }
+    const T& operator[](std::size_t idx) const {
+        if (idx >= len) throw std::out_of_range("SegmentedDeque::operator[] index out of range");
+        return *slot_ptr(idx);
+    }
+
+    // Front / Back access (nullptr-style safe pointers)
+    T* front_ptr() { return len ? slot_ptr(0) : nullptr; }
+    const T* front_ptr() const { return len ? slot_ptr(0) : nullptr; }
+    T* back_ptr() { return len ? slot_ptr(len - 1) : nullptr; }
+    const T* back_ptr() const { return len ? slot_ptr(len - 1) : nullptr; }
+
+    // Push to front
+    void push_front(const T &v) { emplace_front(v); }
+    void push_front(T &&v) { emplace_front(std::move(v)); }
+
+    template<typename... Args>
+    T& emplace_front(Args&&... args) {
+        if (head == 0) {
+            // front block is full (or there is none): open a new one before it
+            reserve_map_slot();
+            T *b = acquire_block();
+            try {
+                Traits::construct(alloc, b + BLOCK_MASK, std::forward<Args>(args)...);
+            } catch (...) {
+                release_block(b);
+                throw;
+            }
+            map_head = (map_head + map_cap - 1) & (map_cap - 1);
+            map[map_head] = b;
+            ++nblocks;
+            head = BLOCK_MASK;
+            ++len;
+            return b[BLOCK_MASK];
+        }
+        T *p = slot_ptr(0) - 1;
+        Traits::construct(alloc, p, std::forward<Args>(args)...);
+        --head;
+        ++len;
+        return *p;
+    }
+
+    // Push to back
+    void push_back(const T &v) { emplace_back(v); }
+    void push_back(T &&v) { emplace_back(std::move(v)); }
+
+    template<typename... Args>
+    T& emplace_back(Args&&... args) {
+        std::size_t off = head + len;
+        if (off == nblocks * BlockSize) {
+            // back block is full (or there is none): open a new one after it
+            reserve_map_slot();
+            T *b = acquire_block();
+            try {
+                Traits::construct(alloc, b, std::forward<Args>(args)...);
+            } catch (...) {
+                release_block(b);
+                throw;
+            }
+            block_at(nblocks) = b;
+            ++nblocks;
+            ++len;
+            return *b;
+        }
+        T *p = block_at(off / BlockSize) + (off & BLOCK_MASK);
+        Traits::construct(alloc, p, std::forward<Args>(args)...);
+        ++len;
+        return *p;
+    }
+
+    // Pop from front (returns false if empty)
+    bool pop_front() {
+        if (len == 0) return false;
+        Traits::destroy(alloc, slot_ptr(0));
+        ++head;
+        --len;
+        if (head == BlockSize) {            // first block drained
+            release_block(block_at(0));
+            map_head = (map_head + 1) & (map_cap - 1);
+            --nblocks;
+            head = 0;
+        }
+        return true;
+    }
+
+    // Pop from back (returns false if empty)
+    bool pop_back() {
+        if (len == 0) return false;
+        --len;
+        Traits::destroy(alloc, slot_ptr(len));
+        if (head + len == (nblocks - 1) * BlockSize) {   // last block drained
+            release_block(block_at(nblocks - 1));
+            --nblocks;
+            if (nblocks == 0) head = 0;
+        }
+        return true;
+    }
+
+    // Destroy all elements and return the blocks (keeps the map and one spare block)
+    void clear() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            for_each([this](T &v) { Traits::destroy(alloc, &v); });
+        }
+        for (std::size_t b = 0; b < nblocks; ++b) release_block(block_at(b));
+        nblocks = map_head = head = len = 0;
+    }
+
+    // Visit elements front -> back, one contiguous block run at a time
+    template<typename F>
+    void for_each(F &&f) {
+        std::size_t i = 0;
+        for (std::size_t b = 0; i < len; ++b) {
+            T *blk = block_at(b);
+            std::size_t from = b == 0 ? head : 0;
+            for (std::size_t s = from; s < BlockSize && i < len; ++s, ++i) f(blk[s]);
+        }
+    }
+    template<typename F>
+    void for_each(F &&f) const {
+        std::size_t i = 0;
+        for (std::size_t b = 0; i < len; ++b) {
+            const T *blk = block_at(b);
+            std::size_t from = b == 0 ? head : 0;
+            for (std::size_t s = from; s < BlockSize && i < len; ++s, ++i) f(blk[s]);
+        }
+    }
+
+    // Convert to vector (utility)
+    template<typename Out = T>
+    std::vector<Out> to_vector() const {
+        std::vector<Out> out;
+        out.reserve(len);
+        for_each([&out](const T &v) { out.push_back(static_cast<Out>(v)); });
+        return out;
+    }
+
+    Alloc get_allocator() const { return alloc; }
+};
+
+#endif // SEGMENTED_DEQUE_H
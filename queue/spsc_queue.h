@@ -0,0 +1,192 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "../common/bit_utils.h"
+
+/*
+  spsc_queue.h
+  - Wait-free bounded single-producer / single-consumer ring queue: the pipeline-stage
+    counterpart of ArrayQueue. Exactly one thread may enqueue and one thread may dequeue.
+  - Only acquire/release loads and stores, no read-modify-write:
+      producer owns tail_ and publishes it with a release store,
+      consumer owns head_ and publishes it with a release store.
+  - Each side keeps a cached copy of the other side's index on its own cache line and only
+    re-reads the shared index when the cached copy says full / empty, so in steady state
+    the two cores do not bounce each other's lines.
+  - Bulk variants move many items and publish them with a single store.
+  - Capacity is rounded up to a power of two (index = pos & mask); all capacity slots are
+    usable because head_/tail_ are free-running counters.
+  - Methods:
+      SPSCQueue(size_t capacity)
+      bool try_enqueue(const T& v) / bool try_enqueue(T&& v)   // producer, false if full
+      template<class... Args> bool try_emplace(Args&&...)      // producer
+      bool try_dequeue(T& out)                                 // consumer, false if empty
+      T* front_ptr()                                           // consumer, nullptr if empty
+      void pop()                                               // consumer, drop front (must exist)
+      size_t enqueue_bulk(const T* items, size_t n)            // producer, returns number enqueued
+      size_t dequeue_bulk(T* out, size_t max)                  // consumer, returns number dequeued
+      size_t capacity() const
+      size_t size_approx() const / bool empty_approx() const
+*/
+
+template<typename T>
+class SPSCQueue {
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct Slot {
+        alignas(T) unsigned char storage[sizeof(T)];
+        T* ptr() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    std::size_t mask_;
+
+    // producer line: its own index plus its view of head
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_;
+    std::size_t head_cache_;
+
+    // consumer line: its own index plus its view of tail
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_;
+    std::size_t tail_cache_;
+
+    // Producer: number of free slots from position t, refreshing head only when needed.
+    std::size_t free_slots(std::size_t t, std::size_t want) {
+        std::size_t cap = mask_ + 1;
+        std::size_t room = cap - (t - head_cache_);
+        if (room < want) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            room = cap - (t - head_cache_);
+        }
+        return room;
+    }
+
+    // Consumer: number of ready slots from position h, refreshing tail only when needed.
+    std::size_t ready_slots(std::size_t h, std::size_t want) {
+        std::size_t ready = tail_cache_ - h;
+        if (ready < want) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            ready = tail_cache_ - h;
+        }
+        return ready;
+    }
+
+public:
+    explicit SPSCQueue(std::size_t capacity = 1024)
+        : mask_(bitutil::next_pow2(capacity < 2 ? 2 : capacity) - 1),
+          tail_(0), head_cache_(0), head_(0), tail_cache_(0) {
+        slots_.reset(new Slot[mask_ + 1]);
+    }
+
+    // Destroys elements still queued; neither thread may be using the queue.
+    ~SPSCQueue() {
+        if constexpr (!std::is_trivially_destructible<T>::value) {
+            std::size_t t = tail_.load(std::memory_order_relaxed);
+            for (std::size_t h = head_.load(std::memory_order_relaxed); h != t; ++h)
+                slots_[h & mask_].ptr()->~T();
+        }
+    }
+
+    // non-copyable, non-movable (shared between threads by reference)
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    std::size_t size_approx() const {
+        std::size_t h = head_.load(std::memory_order_acquire); // head first: tail >= head
+        std::size_t t = tail_.load(std::memory_order_acquire);
+        return t - h;
+    }
+    bool empty_approx() const { return size_approx() == 0; }
+
+    // ---------- producer side ----------
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        std::size_t t = tail_.load(std::memory_order_relaxed);
+        if (free_slots(t, 1) == 0) return false;
+        ::new (static_cast<void*>(slots_[t & mask_].storage)) T(std::forward<Args>(args)...);
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_enqueue(const T &v) { return try_emplace(v); }
+    bool try_enqueue(T &&v) { return try_emplace(std::move(v)); }
+
+    // Copy up to n items (a prefix of items) in and publish them with one store.
+    // If a copy throws, the copies already made are destroyed and nothing is enqueued.
+    std::size_t enqueue_bulk(const T *items, std::size_t n) {
+        std::size_t t = tail_.load(std::memory_order_relaxed);
+        std::size_t k = free_slots(t, n);
+        if (k > n) k = n;
+        if (k == 0) return 0;
+        std::size_t i = 0;
+        try {
+            for (; i < k; ++i)
+                ::new (static_cast<void*>(slots_[(t + i) & mask_].storage)) T(items[i]);
+        } catch (...) {
+            while (i > 0) slots_[(t + --i) & mask_].ptr()->~T();
+            throw;
+        }
+        tail_.store(t + k, std::memory_order_release);
+        return k;
+    }
+
+    // ---------- consumer side ----------
+
+    // Peek at the front element without removing it (nullptr if empty)
+    T* front_ptr() {
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        if (ready_slots(h, 1) == 0) return nullptr;
+        return slots_[h & mask_].ptr();
+    }
+
+    // Drop the front element; front_ptr() must have returned non-null.
+    void pop() {
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        slots_[h & mask_].ptr()->~T();
+        head_.store(h + 1, std::memory_order_release);
+    }
+
+    bool try_dequeue(T &out) {
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        if (ready_slots(h, 1) == 0) return false;
+        T *p = slots_[h & mask_].ptr();
+        out = std::move(*p);
+        p->~T();
+        head_.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Move up to max items out and release their slots with one store.
+    // If a move-assignment throws, the items already moved out are released and the
+    // exception propagates; the item that threw stays at the front.
+    std::size_t dequeue_bulk(T *out, std::size_t max) {
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        std::size_t k = ready_slots(h, max);
+        if (k > max) k = max;
+        if (k == 0) return 0;
+        std::size_t i = 0;
+        try {
+            for (; i < k; ++i) {
+                T *p = slots_[(h + i) & mask_].ptr();
+                out[i] = std::move(*p);
+                p->~T();
+            }
+        } catch (...) {
+            head_.store(h + i, std::memory_order_release);
+            throw;
+        }
+        head_.store(h + k, std::memory_order_release);
+        return k;
+    }
+};
+
+#endif // SPSC_QUEUE_H
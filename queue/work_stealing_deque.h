@@ -0,0 +1,131 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../common/bit_utils.h"
+
+/*
+  work_stealing_deque.h
+  - Chase–Lev work-stealing deque (the C11 formulation by Lê, Pop, Cohen & Zappa Nardelli):
+    the concurrent relative of Deque, restricted to the three operations a scheduler needs.
+      owner thread:   push(v) / pop(out) at the bottom  (LIFO, cache-warm)
+      any thread:     steal(out) from the top            (FIFO, oldest = biggest task)
+  - push/pop touch only the owner's end and need no CAS except when racing a thief for the
+    last element; steal is one CAS on top.
+  - Growable: when full, the owner copies the live range into a ring twice the size.
+    Thieves may still be reading the old ring, so retired rings are kept until the deque
+    is destroyed (total retired memory < the final ring size).
+  - T must be trivially copyable (typically a task pointer or an index): a thief reads a
+    slot before it knows whether it won the race for it.
+  - Capacity is a power of two (index = pos & mask).
+  - Methods:
+      WorkStealingDeque(size_t initial_capacity = 64)
+      void push(T v)                 // owner only
+      bool pop(T& out)               // owner only, false if empty
+      bool steal(T& out)             // any thread, false if empty or the race was lost
+      size_t size_approx() const / bool empty_approx() const
+      size_t capacity() const        // owner only
+*/
+
+template<typename T>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque: T must be trivially copyable");
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    struct Ring {
+        std::size_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+
+        explicit Ring(std::size_t cap) : mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        std::size_t capacity() const { return mask + 1; }
+        void put(std::int64_t i, T v) { slots[static_cast<std::size_t>(i) & mask].store(v, std::memory_order_relaxed); }
+        T get(std::int64_t i) const { return slots[static_cast<std::size_t>(i) & mask].load(std::memory_order_relaxed); }
+    };
+
+    alignas(CACHE_LINE) std::atomic<std::int64_t> top_;     // thieves' end
+    alignas(CACHE_LINE) std::atomic<std::int64_t> bottom_;  // owner's end
+    std::atomic<Ring*> ring_;
+    std::vector<std::unique_ptr<Ring>> rings_;               // current + retired, owner only
+
+    Ring* grow(Ring *old, std::int64_t b, std::int64_t t) {
+        rings_.emplace_back(new Ring(old->capacity() * 2));
+        Ring *r = rings_.back().get();
+        for (std::int64_t i = t; i < b; ++i) r->put(i, old->get(i));
+        ring_.store(r, std::memory_order_release);
+        return r;
+    }
+
+public:
+    explicit WorkStealingDeque(std::size_t initial_capacity = 64) : top_(0), bottom_(0) {
+        rings_.emplace_back(new Ring(bitutil::next_pow2(initial_capacity < 2 ? 2 : initial_capacity)));
+        ring_.store(rings_.back().get(), std::memory_order_relaxed);
+    }
+
+    // non-copyable, non-movable (shared between threads by reference)
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    std::size_t capacity() const { return ring_.load(std::memory_order_relaxed)->capacity(); }
+
+    std::size_t size_approx() const {
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<std::size_t>(b - t) : 0;
+    }
+    bool empty_approx() const { return size_approx() == 0; }
+
+    // Owner: push at the bottom
+    void push(T v) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        Ring *r = ring_.load(std::memory_order_relaxed);
+        if (b - t > static_cast<std::int64_t>(r->mask)) r = grow(r, b, t);
+        r->put(b, v);
+        bottom_.store(b + 1, std::memory_order_release); // publish the slot to thieves
+    }
+
+    // Owner: pop from the bottom (most recently pushed)
+    bool pop(T &out) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring *r = ring_.load(std::memory_order_relaxed);
+        // Reserve slot b before looking at top; seq_cst orders this store before the load.
+        bottom_.store(b, std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+        if (t > b) {                       // empty
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        out = r->get(b);
+        if (t == b) {                      // last element: race the thieves for it
+            bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread: steal from the top (oldest element)
+    bool steal(T &out) {
+        std::int64_t t = top_.load(std::memory_order_seq_cst);
+        std::int64_t b = bottom_.load(std::memory_order_seq_cst);
+        if (t >= b) return false;
+        Ring *r = ring_.load(std::memory_order_acquire);
+        T v = r->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return false;                  // another thief or the owner got it
+        out = v;
+        return true;
+    }
+};
+
+#endif // WORK_STEALING_DEQUE_H
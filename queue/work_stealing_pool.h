@@ -0,0 +1,242 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "deque.h"
+#include "work_stealing_deque.h"
+
+/*
+  work_stealing_pool.h
+  - Small fork/join thread pool on top of WorkStealingDeque.
+  - Every worker owns a deque: tasks it spawns go to its own bottom and are popped LIFO
+    (cache-warm, depth-first); an idle worker steals from the top of a randomly chosen
+    victim (oldest = usually the biggest piece of remaining work).
+  - Tasks submitted from outside the pool go to a mutex-protected injection Deque.
+  - Idle workers sleep on a condition variable and are woken when work is queued.
+  - A thread waiting in parallel_for keeps running queued tasks instead of blocking, so
+    nested parallelism cannot deadlock.
+  - Tasks passed to submit() must not throw (an escaping exception calls std::terminate);
+    an exception from a parallel_for body is caught and rethrown to the caller.
+  - Methods:
+      WorkStealingPool(size_t threads = hardware_concurrency)
+      template<class F> void submit(F&& f)                       // fire and forget
+      template<class F> void parallel_for(begin, end, F&& body, size_t grain = 0)
+                                                                 // body(i) for i in [begin, end), blocks;
+                                                                 // rethrows the first exception from body
+      void wait_idle()                                           // block until every task has run (non-worker threads)
+      size_t size() const                                        // number of workers
+      static size_t worker_index()                               // 0..size()-1 on a worker, NPOS elsewhere
+*/
+
+class WorkStealingPool {
+public:
+    static constexpr std::size_t NPOS = static_cast<std::size_t>(-1);
+
+private:
+    struct Task {
+        std::function<void()> fn;
+    };
+
+    std::vector<std::unique_ptr<WorkStealingDeque<Task*>>> deques_;
+    std::vector<std::thread> threads_;
+
+    std::mutex inject_mu_;
+    Deque<Task*> inject_;                 // tasks submitted by non-worker threads
+    std::atomic<std::size_t> inject_len_; // lets workers skip the lock when inject_ is empty
+
+    std::mutex sleep_mu_;
+    std::condition_variable wake_cv_;     // workers: work was queued / shutdown
+    std::condition_variable idle_cv_;     // wait_idle(): pending_ dropped to 0
+    std::atomic<std::size_t> queued_;     // tasks sitting in a deque or the injection queue
+    std::atomic<std::size_t> pending_;    // tasks submitted and not yet finished
+    std::atomic<std::size_t> sleepers_;
+    bool stop_;
+
+    inline static thread_local WorkStealingPool *tl_pool_ = nullptr;
+    inline static thread_local std::size_t tl_index_ = NPOS;
+    inline static thread_local std::uint64_t tl_rng_ = 0;
+
+    static std::uint64_t next_random() {
+        // xorshift64; seeded per thread on first use
+        if (tl_rng_ == 0) tl_rng_ = reinterpret_cast<std::uintptr_t>(&tl_rng_) | 1;
+        tl_rng_ ^= tl_rng_ << 13;
+        tl_rng_ ^= tl_rng_ >> 7;
+        tl_rng_ ^= tl_rng_ << 17;
+        return tl_rng_;
+    }
+
+    bool on_worker() const { return tl_pool_ == this; }
+
+    void enqueue(Task *task) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        queued_.fetch_add(1, std::memory_order_seq_cst);   // before publishing: never underflows
+        if (on_worker()) {
+            deques_[tl_index_]->push(task);
+        } else {
+            std::lock_guard<std::mutex> lk(inject_mu_);
+            inject_.push_back(task);
+            inject_len_.store(inject_.size(), std::memory_order_relaxed);
+        }
+        if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+            // take the lock so a worker between its check and its wait can't miss this
+            { std::lock_guard<std::mutex> lk(sleep_mu_); }
+            wake_cv_.notify_one();
+        }
+    }
+
+    // Find a task: own deque, then the injection queue, then a random victim.
+    Task* find_task() {
+        Task *task = nullptr;
+        if (on_worker() && deques_[tl_index_]->pop(task)) return task;
+        if (inject_len_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lk(inject_mu_);
+            if (!inject_.empty()) {
+                task = *inject_.front_ptr();
+                inject_.pop_front();
+                inject_len_.store(inject_.size(), std::memory_order_relaxed);
+                return task;
+            }
+        }
+        std::size_t n = deques_.size();
+        std::size_t start = static_cast<std::size_t>(next_random() % n);
+        for (std::size_t k = 0; k < n; ++k) {
+            std::size_t v = (start + k) % n;
+            if (on_worker() && v == tl_index_) continue;
+            if (deques_[v]->steal(task)) return task;
+        }
+        return nullptr;
+    }
+
+    void run(Task *task) {
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        task->fn();
+        delete task;
+        if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lk(sleep_mu_);
+            idle_cv_.notify_all();
+        }
+    }
+
+    // Run one queued task if there is one; used by waiting threads to help out.
+    bool run_one() {
+        Task *task = find_task();
+        if (!task) return false;
+        run(task);
+        return true;
+    }
+
+    void worker_loop(std::size_t index) {
+        tl_pool_ = this;
+        tl_index_ = index;
+        for (;;) {
+            if (run_one()) continue;
+            if (queued_.load(std::memory_order_seq_cst) > 0) {
+                std::this_thread::yield();   // a task is in flight (being pushed or stolen)
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(sleep_mu_);
+            sleepers_.fetch_add(1, std::memory_order_seq_cst);
+            wake_cv_.wait(lk, [this] { return stop_ || queued_.load(std::memory_order_seq_cst) > 0; });
+            sleepers_.fetch_sub(1, std::memory_order_relaxed);
+            if (stop_ && queued_.load(std::memory_order_seq_cst) == 0) return;
+        }
+    }
+
+public:
+    explicit WorkStealingPool(std::size_t threads = std::thread::hardware_concurrency())
+        : inject_len_(0), queued_(0), pending_(0), sleepers_(0), stop_(false) {
+        if (threads == 0) threads = 1;
+        for (std::size_t i = 0; i < threads; ++i)
+            deques_.emplace_back(new WorkStealingDeque<Task*>());
+        threads_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i)
+            threads_.emplace_back([this, i] { worker_loop(i); });
+    }
+
+    // Runs every task still queued, then joins the workers.
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lk(sleep_mu_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+        for (std::thread &t : threads_) t.join();
+    }
+
+    // non-copyable, non-movable (workers hold a pointer to the pool)
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t size() const { return threads_.size(); }
+
+    static std::size_t worker_index() { return tl_index_; }
+
+    template<typename F>
+    void submit(F &&f) {
+        enqueue(new Task{std::function<void()>(std::forward<F>(f))});
+    }
+
+    // Block until every submitted task has finished (not from inside a task: it would wait
+    // for itself; use parallel_for there).
+    void wait_idle() {
+        assert(!on_worker());
+        std::unique_lock<std::mutex> lk(sleep_mu_);
+        idle_cv_.wait(lk, [this] { return pending_.load(std::memory_order_acquire) == 0; });
+    }
+
+    // Call body(i) for every i in [begin, end) and wait for all of them.
+    // The range is split in halves down to `grain` (default: ~8 pieces per worker); the
+    // upper halves are spawned, so thieves take large chunks and the owner keeps locality.
+    // If body throws, pieces not started yet skip their iterations, and once every spawned
+    // piece has finished (they reference this frame) the first exception is rethrown here.
+    template<typename F>
+    void parallel_for(std::size_t begin, std::size_t end, F &&body, std::size_t grain = 0) {
+        if (begin >= end) return;
+        std::size_t n = end - begin;
+        if (grain == 0) grain = std::max<std::size_t>(1, n / (size() * 8));
+
+        std::atomic<std::size_t> remaining(n);
+        std::atomic<bool> failed(false);
+        std::exception_ptr error;
+        std::mutex error_mu;
+        std::function<void(std::size_t, std::size_t)> range;
+        range = [&](std::size_t b, std::size_t e) {
+            try {
+                while (e - b > grain) {
+                    std::size_t mid = b + (e - b) / 2;
+                    submit([&range, mid, e] { range(mid, e); });
+                    e = mid;
+                }
+                for (std::size_t i = b; i < e && !failed.load(std::memory_order_relaxed); ++i) body(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(error_mu);
+                if (!error) error = std::current_exception();
+                failed.store(true, std::memory_order_relaxed);
+            }
+            // [b, e) is now done or abandoned; spawned upper halves count themselves
+            remaining.fetch_sub(e - b, std::memory_order_acq_rel);
+        };
+
+        range(begin, end);
+        // help with queued work (ours or anyone's) until our range is done
+        while (remaining.load(std::memory_order_acquire) > 0) {
+            if (!run_one()) std::this_thread::yield();
+        }
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+#endif // WORK_STEALING_POOL_H
@@ -5,11 +5,15 @@
 #include <stdexcept>
 #include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <utility>
+#include "../allocators/node_alloc.h"
 
 /*
   linked_stack.h
   - Stack implemented using singly-linked list
   - push, pop, top, empty, size, clear
+  - Alloc: node allocator (std::allocator by default; see allocators/ for arena & pool)
 */
 
 template<typename T>
@@ -19,16 +23,20 @@ struct StackNode {
     StackNode(const T &v) : val(v), next(nullptr) {}
 };
 
-template<typename T>
+template<typename T, typename Alloc = std::allocator<T>>
 class LinkedStack {
 private:
     StackNode<T> *head;
     std::size_t len;
 
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<StackNode<T>>;
+    NodeAlloc alloc;
+
 public:
     // Constructors
-    LinkedStack() : head(nullptr), len(0) {}
-    LinkedStack(std::initializer_list<T> il) : head(nullptr), len(0) {
+    LinkedStack() : head(nullptr), len(0), alloc() {}
+    explicit LinkedStack(const Alloc &a) : head(nullptr), len(0), alloc(a) {}
+    LinkedStack(std::initializer_list<T> il, const Alloc &a = Alloc()) : head(nullptr), len(0), alloc(a) {
         for (auto &v : il) push(v);
     }
 
@@ -39,7 +47,7 @@ public:
     LinkedStack& operator=(const LinkedStack&) = delete;
 
     // Allow move
-    LinkedStack(LinkedStack&& other) noexcept {
+    LinkedStack(LinkedStack&& other) noexcept : alloc(std::move(other.alloc)) {
         head = other.head;
         len = other.len;
         other.head = nullptr;
@@ -48,6 +56,7 @@ public:
     LinkedStack& operator=(LinkedStack&& other) noexcept {
         if (this != &other) {
             clear();
+            alloc = std::move(other.alloc);
             head = other.head;
             len = other.len;
             other.head = nullptr;
@@ -62,7 +71,7 @@ public:
 
     // Push onto stack
     void push(const T &v) {
-        StackNode<T> *n = new StackNode<T>(v);
+        StackNode<T> *n = nodealloc::create_node(alloc, v);
         n->next = head;
         head = n;
         ++len;
@@ -73,7 +82,7 @@ public:
         if (!head) return false;
         StackNode<T> *tmp = head;
         head = head->next;
-        delete tmp;
+        nodealloc::destroy_node(alloc, tmp);
         --len;
         return true;
     }
@@ -104,7 +113,7 @@ public:
     void clear() {
         while (head) {
             StackNode<T> *nx = head->next;
-            delete head;
+            nodealloc::destroy_node(alloc, head);
             head = nx;
         }
         len = 0;